@@ -0,0 +1,128 @@
+//##########################################################################
+//#
+//#		Dashboard.ino
+//#
+//#	This program shows how a screen is defined once as a layout:
+//#		- the labels are printed once by ShowLayout()
+//#		- the values are printed into fields with SetField() and
+//#		  SetFieldNumber(), only the characters that have changed are
+//#		  transmitted to the display
+//#
+//#	There is no need to clear and reprint the whole screen in loop().
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Dieses Programm zeigt, wie ein Bildschirm einmal als Layout
+//#	festgelegt wird:
+//#		- die Beschriftungen werden einmal von ShowLayout() ausgegeben
+//#		- die Werte werden mit SetField() und SetFieldNumber() in Felder
+//#		  geschrieben, nur die geänderten Zeichen werden zum Display
+//#		  übertragen
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <simple_oled_sh1106.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define VALUE_INTERVAL_MILLIS		250
+
+//----	index of the fields  -----------------------------------------------
+#define FIELD_SPEED				0
+#define FIELD_VOLTAGE			1
+#define FIELD_STATE				2
+
+//----	labels  ------------------------------------------------------------
+const char	g_strTitle[]	PROGMEM	= " Dashboard ";
+const char	g_strSpeed[]	PROGMEM	= "Speed:";
+const char	g_strRpm[]		PROGMEM	= "rpm";
+const char	g_strVoltage[]	PROGMEM	= "Voltage:";
+const char	g_strVolt[]		PROGMEM	= "V";
+const char	g_strState[]	PROGMEM	= "State:";
+
+const SimpleOledLabel	g_artLabels[] PROGMEM =
+{
+	{ 0,  2,	SIMPLE_OLED_INVERSE,	g_strTitle		},
+	{ 2,  0,	0,						g_strSpeed		},
+	{ 2, 13,	0,						g_strRpm		},
+	{ 4,  0,	0,						g_strVoltage	},
+	{ 4, 15,	0,						g_strVolt		},
+	{ 6,  0,	0,						g_strState		}
+};
+
+//----	fields  ------------------------------------------------------------
+const SimpleOledField	g_artFields[] PROGMEM =
+{
+	{ 2,  7,	5,	SIMPLE_OLED_ALIGN_RIGHT		},	//	FIELD_SPEED
+	{ 4,  9,	5,	SIMPLE_OLED_ALIGN_RIGHT		},	//	FIELD_VOLTAGE
+	{ 6,  7,	9,	SIMPLE_OLED_ALIGN_CENTER	}	//	FIELD_STATE
+};
+
+//----	layout  ------------------------------------------------------------
+const SimpleOledLayout	g_tDashboard PROGMEM =
+{
+	g_artLabels,	sizeof( g_artLabels ) / sizeof( g_artLabels[ 0 ] ),
+	g_artFields,	sizeof( g_artFields ) / sizeof( g_artFields[ 0 ] )
+};
+
+uint32_t	g_ulLastChange	= 0;
+uint16_t	g_uiSpeed		= 0;
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	description
+//
+void setup()
+{
+	g_clDisplay.Init();
+	g_clDisplay.ShowLayout( &g_tDashboard );
+
+	g_clDisplay.SetField( FIELD_STATE, F( "stopped" ) );
+}
+
+
+//**************************************************************************
+//	loop
+//--------------------------------------------------------------------------
+//	description
+//
+void loop()
+{
+	uint32_t	ulNow = millis();
+
+	if( VALUE_INTERVAL_MILLIS <= (ulNow - g_ulLastChange) )
+	{
+		g_ulLastChange = ulNow;
+		g_uiSpeed += 7;
+
+		//------------------------------------------------------------------
+		//	only the changed characters of the fields are transmitted
+		//
+		g_clDisplay.SetFieldNumber( FIELD_SPEED, g_uiSpeed );
+		g_clDisplay.SetFieldNumber( FIELD_VOLTAGE, 1200 + (g_uiSpeed % 80), 2 );
+
+		if( 0 == g_uiSpeed )
+		{
+			g_clDisplay.SetField( FIELD_STATE, F( "stopped" ) );
+		}
+		else
+		{
+			g_clDisplay.SetField( FIELD_STATE, F( "running" ) );
+		}
+	}
+}
@@ -0,0 +1,92 @@
+//##########################################################################
+//#
+//#		EventLog.ino
+//#
+//#	This program shows a fixed title line and a fixed status line
+//#	around an event log that scrolls:
+//#		- the PrintMode is scroll line
+//#		- SetScrollRegion( 1, 6 ) lets only the lines 1 to 6 scroll,
+//#		  the lines 0 and 7 are never rewritten by the log
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Dieses Programm zeigt eine feste Titelzeile und eine feste Statuszeile
+//#	um ein Ereignisprotokoll, das scrollt:
+//#		- der PrintMode ist scroll line
+//#		- SetScrollRegion( 1, 6 ) lässt nur die Zeilen 1 bis 6 scrollen,
+//#		  die Zeilen 0 und 7 werden vom Protokoll nie überschrieben
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <simple_oled_sh1106.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define EVENT_INTERVAL_MILLIS	400
+
+#define LINE_TITLE				0
+#define LINE_LOG_FIRST			1
+#define LINE_LOG_LAST			6
+#define LINE_STATUS				7
+
+uint32_t	g_ulLastEvent	= 0;
+uint16_t	g_uiEvent		= 0;
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	description
+//
+void setup()
+{
+	g_clDisplay.Init();
+	g_clDisplay.SetPrintModeScrollLine();
+	g_clDisplay.SetScrollRegion( LINE_LOG_FIRST, LINE_LOG_LAST );
+
+	g_clDisplay.SetInverseFont( true );
+	g_clDisplay.Print( F( "   Event log    " ) );
+	g_clDisplay.SetInverseFont( false );
+
+	g_clDisplay.SetCursor( LINE_LOG_FIRST, 0 );
+}
+
+
+//**************************************************************************
+//	loop
+//--------------------------------------------------------------------------
+//	description
+//
+void loop()
+{
+	uint32_t	ulNow = millis();
+
+	if( EVENT_INTERVAL_MILLIS <= (ulNow - g_ulLastEvent) )
+	{
+		g_ulLastEvent = ulNow;
+		g_uiEvent++;
+
+		//------------------------------------------------------------------
+		//	the status line is printed into a field,
+		//	the cursor of the log is set again afterwards
+		//
+		g_clDisplay.PrintNumber( LINE_STATUS, 0, 6, g_uiEvent );
+
+		g_clDisplay.SetCursor( LINE_LOG_LAST, 0 );
+		g_clDisplay.print( F( "\nevent " ) );
+		g_clDisplay.print( g_uiEvent );
+	}
+}
@@ -0,0 +1,113 @@
+//##########################################################################
+//#
+//#		Graphics.ino
+//#
+//#	This program shows the graphic functions:
+//#		- DrawRect() draws a frame, DrawBitmap() an icon from PROGMEM
+//#		- loop() moves a level bar, FillRect() sets or clears only the
+//#		  columns of the bar that have changed
+//#	Text and graphics share the display, the bar is placed in the pages
+//#	below the text lines. Without framebuffer a page that is covered
+//#	only partly must be read back from the display (not possible with
+//#	SPI), so the bar is page aligned and needs no reads.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Dieses Programm zeigt die Grafikfunktionen:
+//#		- DrawRect() zeichnet einen Rahmen, DrawBitmap() ein Symbol aus
+//#		  dem PROGMEM
+//#		- loop() bewegt einen Balken, FillRect() setzt oder löscht nur
+//#		  die Spalten des Balkens, die sich geändert haben
+//#	Text und Grafik teilen sich das Display, der Balken liegt in den
+//#	Pages unter den Textzeilen. Ohne Framebuffer muss eine Page, die
+//#	nur teilweise bedeckt ist, vom Display zurückgelesen werden (mit SPI
+//#	nicht möglich), daher ist der Balken an den Pages ausgerichtet und
+//#	braucht keine Lesezugriffe.
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <simple_oled_sh1106.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define LEVEL_INTERVAL_MILLIS	50
+
+#define BAR_X					4
+#define BAR_Y					40
+#define BAR_WIDTH				120
+#define BAR_HEIGHT				16
+
+//----	8 x 8 pixels, one byte per column, bit 0 is the top row  -----------
+const uint8_t	g_arusIcon[] PROGMEM	= { 0x3C, 0x42, 0xA5, 0x81, 0xA5, 0x99, 0x42, 0x3C };
+
+uint32_t	g_ulLastLevel	= 0;
+uint8_t		g_usLevel		= 0;
+int8_t		g_sStep			= 4;
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	description
+//
+void setup()
+{
+	g_clDisplay.Init();
+	g_clDisplay.Clear();
+
+	g_clDisplay.DrawBitmap( 0, 0, 8, 8, g_arusIcon );
+	g_clDisplay.SetCursor( 0, 2 );
+	g_clDisplay.Print( F( "Level" ) );
+
+	g_clDisplay.DrawRect( BAR_X - 2, BAR_Y - 2, BAR_WIDTH + 4, BAR_HEIGHT + 4 );
+}
+
+
+//**************************************************************************
+//	loop
+//--------------------------------------------------------------------------
+//	description
+//
+void loop()
+{
+	uint32_t	ulNow = millis();
+
+	if( LEVEL_INTERVAL_MILLIS <= (ulNow - g_ulLastLevel) )
+	{
+		uint8_t	usLevel = g_usLevel + g_sStep;
+
+		g_ulLastLevel = ulNow;
+
+		if( (0 == usLevel) || (BAR_WIDTH == usLevel) )
+		{
+			g_sStep = -g_sStep;
+		}
+
+		//------------------------------------------------------------------
+		//	only the columns between the old and the new level change
+		//
+		if( usLevel > g_usLevel )
+		{
+			g_clDisplay.FillRect( BAR_X + g_usLevel, BAR_Y, usLevel - g_usLevel, BAR_HEIGHT, true );
+		}
+		else
+		{
+			g_clDisplay.FillRect( BAR_X + usLevel, BAR_Y, g_usLevel - usLevel, BAR_HEIGHT, false );
+		}
+
+		g_usLevel = usLevel;
+	}
+}
@@ -0,0 +1,107 @@
+//##########################################################################
+//#
+//#		MultiDisplay.ino
+//#
+//#	This program shows how two OLED displays on the same I²C bus are
+//#	used together with the class SimpleDisplayManager:
+//#		- one display at address DISPLAY_ADDRESS (60)
+//#		  and one at SECOND_DISPLAY_ADDRESS (61)
+//#		- asynchronous output, the manager sends the changes of both
+//#		  displays in turns within a fixed time per loop()
+//#
+//#	The asynchronous mode needs a transmit queue, e.g. set
+//#	SIMPLE_OLED_TX_QUEUE_SIZE to 256 in simple_oled_config.h.
+//#	Without transmit queue the output is sent at once.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Dieses Programm zeigt, wie zwei OLED Displays an einem I²C Bus
+//#	zusammen mit der Klasse SimpleDisplayManager betrieben werden:
+//#		- ein Display an der Adresse DISPLAY_ADDRESS (60)
+//#		  und eines an SECOND_DISPLAY_ADDRESS (61)
+//#		- asynchrone Ausgabe, der Manager sendet die Änderungen beider
+//#		  Displays abwechselnd innerhalb einer festen Zeit pro loop()
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <stdio.h>
+#include <simple_oled_sh1106.h>
+#include <simple_oled_manager.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define UPDATE_BUDGET_MICROS	2000
+#define CHANGE_INTERVAL_MILLIS	100
+
+SimpleDisplayClass		g_clSecondDisplay;
+SimpleDisplayManager	g_clDisplays;
+
+uint32_t	g_ulLastChange	= 0;
+uint16_t	g_uiCounter		= 0;
+char		g_buffer[ 20 ];
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	description
+//
+void setup()
+{
+	g_clDisplay.Init( DISPLAY_ADDRESS );
+	g_clSecondDisplay.Init( SECOND_DISPLAY_ADDRESS );
+
+	g_clDisplays.Add( g_clDisplay );
+	g_clDisplays.Add( g_clSecondDisplay );
+	g_clDisplays.SetAsync( true );
+
+	g_clDisplay.Print( F( "First Display" ) );
+	g_clSecondDisplay.Print( F( "Second Display" ) );
+}
+
+
+//**************************************************************************
+//	loop
+//--------------------------------------------------------------------------
+//	description
+//
+void loop()
+{
+	uint32_t	ulNow = millis();
+
+	//----------------------------------------------------------------------
+	//	change the output of both displays from time to time
+	//
+	if( CHANGE_INTERVAL_MILLIS <= (ulNow - g_ulLastChange) )
+	{
+		g_ulLastChange = ulNow;
+		g_uiCounter++;
+
+		sprintf( g_buffer, "Count: %5u", g_uiCounter );
+		g_clDisplay.SetCursor( 3, 0 );
+		g_clDisplay.Print( g_buffer );
+
+		sprintf( g_buffer, "Time: %5lu s", (unsigned long)(ulNow / 1000) );
+		g_clSecondDisplay.SetCursor( 3, 0 );
+		g_clSecondDisplay.Print( g_buffer );
+	}
+
+	//----------------------------------------------------------------------
+	//	send the changes of both displays, but spend not more than
+	//	UPDATE_BUDGET_MICROS in this loop
+	//
+	g_clDisplays.Update( UPDATE_BUDGET_MICROS );
+}
@@ -0,0 +1,82 @@
+//##########################################################################
+//#
+//#		SmoothScroll.ino
+//#
+//#	This program shows a log output with smooth scroll:
+//#		- the PrintMode is scroll line
+//#		- the display moves one pixel row per step, not a whole line
+//#		- Update() has to be called from loop(), it does the steps
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Dieses Programm zeigt eine Log-Ausgabe mit weichem Scrollen:
+//#		- der PrintMode ist scroll line
+//#		- das Display wird pro Schritt um eine Pixelzeile verschoben,
+//#		  nicht um eine ganze Zeile
+//#		- Update() muss in loop() aufgerufen werden, es führt die
+//#		  Schritte aus
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <simple_oled_sh1106.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define LOG_INTERVAL_MILLIS		500
+#define SCROLL_STEP_MILLIS		15
+
+uint32_t	g_ulLastLog	= 0;
+uint16_t	g_uiEvent	= 0;
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	description
+//
+void setup()
+{
+	g_clDisplay.Init();
+	g_clDisplay.SetPrintModeScrollLine();
+	g_clDisplay.SetSmoothScroll( true, SCROLL_STEP_MILLIS );
+
+	g_clDisplay.Print( F( "Event log" ) );
+}
+
+
+//**************************************************************************
+//	loop
+//--------------------------------------------------------------------------
+//	description
+//
+void loop()
+{
+	uint32_t	ulNow = millis();
+
+	if( LOG_INTERVAL_MILLIS <= (ulNow - g_ulLastLog) )
+	{
+		g_ulLastLog = ulNow;
+		g_uiEvent++;
+
+		g_clDisplay.print( F( "\nevent " ) );
+		g_clDisplay.print( g_uiEvent );
+	}
+
+	//----------------------------------------------------------------------
+	//	move the display one pixel row if the time has come
+	//
+	g_clDisplay.Update();
+}
@@ -0,0 +1,99 @@
+//##########################################################################
+//#
+//#		Trace.ino
+//#
+//#	This program shows how to find the cause of a slow display output
+//#	with the trace of the library:
+//#		- the trace must be switched on in simple_oled_config.h, e.g.
+//#		  #define SIMPLE_OLED_TRACE_SIZE 128
+//#		- the program updates a counter and measures the time of the
+//#		  output, an output that takes longer than STALL_MICROS writes
+//#		  the trace to Serial and clears it
+//#		- the log of the serial monitor can be decoded with the program
+//#		  extras/host/trace_decode into a timeline and histograms
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Dieses Programm zeigt, wie mit dem Trace der Bibliothek die Ursache
+//#	einer langsamen Ausgabe auf das Display gefunden werden kann:
+//#		- der Trace muss in simple_oled_config.h eingeschaltet werden,
+//#		  z.B. #define SIMPLE_OLED_TRACE_SIZE 128
+//#		- das Programm aktualisiert einen Zähler und misst die Zeit der
+//#		  Ausgabe, dauert eine Ausgabe länger als STALL_MICROS, wird der
+//#		  Trace über Serial ausgegeben und gelöscht
+//#		- das Protokoll des seriellen Monitors kann mit dem Programm
+//#		  extras/host/trace_decode in eine Zeitachse und Histogramme
+//#		  umgewandelt werden
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <simple_oled_sh1106.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define UPDATE_INTERVAL_MILLIS	50
+#define STALL_MICROS			20000UL
+
+uint32_t	g_ulLastUpdate	= 0;
+uint16_t	g_uiCounter		= 0;
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	description
+//
+void setup()
+{
+	Serial.begin( 115200 );
+
+	g_clDisplay.Init();
+	g_clDisplay.Clear();
+	g_clDisplay.Print( F( "Trace" ) );
+	g_clDisplay.SetCursor( 2, 0 );
+	g_clDisplay.Print( F( "Counter:" ) );
+
+	//----------------------------------------------------------------------
+	//	the trace starts after the setup
+	//
+	g_clDisplay.ClearTrace();
+}
+
+
+//**************************************************************************
+//	loop
+//--------------------------------------------------------------------------
+//	description
+//
+void loop()
+{
+	uint32_t	ulNow = millis();
+	uint32_t	ulStart;
+
+	if( UPDATE_INTERVAL_MILLIS <= (ulNow - g_ulLastUpdate) )
+	{
+		g_ulLastUpdate = ulNow;
+
+		ulStart = micros();
+		g_clDisplay.PrintNumber( 2, 9, 5, ++g_uiCounter );
+
+		if( STALL_MICROS < (micros() - ulStart) )
+		{
+			g_clDisplay.DumpTrace( Serial );
+			g_clDisplay.ClearTrace();
+		}
+	}
+}
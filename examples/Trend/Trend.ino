@@ -0,0 +1,108 @@
+//##########################################################################
+//#
+//#		Trend.ino
+//#
+//#	This program shows the history of a value as sparkline and the
+//#	actual value as bar graph (see simple_oled_widgets.h):
+//#		- each new sample writes one column of the sparkline, the columns
+//#		  are used like a ring, the graph is never shifted
+//#		- the bar graph sets or clears only the columns between the old
+//#		  and the new length of the bar
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Dieses Programm zeigt den Verlauf eines Wertes als Sparkline und den
+//#	aktuellen Wert als Balken (siehe simple_oled_widgets.h):
+//#		- jeder neue Messwert schreibt eine Spalte der Sparkline, die
+//#		  Spalten werden wie ein Ring benutzt, die Grafik wird nie
+//#		  verschoben
+//#		- der Balken setzt oder löscht nur die Spalten zwischen der alten
+//#		  und der neuen Länge des Balkens
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <simple_oled_sh1106.h>
+#include <simple_oled_widgets.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define SAMPLE_INTERVAL_MILLIS	100
+
+#define VALUE_MIN				0
+#define VALUE_MAX				1000
+
+SimpleOledSparkline	g_clSparkline;
+SimpleOledBarGraph	g_clBarGraph;
+
+uint32_t	g_ulLastSample	= 0;
+int16_t		g_iValue		= 500;
+int16_t		g_iStep			= 37;
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	description
+//
+void setup()
+{
+	g_clDisplay.Init();
+	g_clDisplay.Clear();
+	g_clDisplay.Print( F( "Trend" ) );
+
+	//----------------------------------------------------------------------
+	//	bar graph in page 1, sparkline in the pages 2 to 7
+	//
+	g_clBarGraph.Init( g_clDisplay, 0, 1, 128, 1, VALUE_MIN, VALUE_MAX );
+	g_clSparkline.Init( g_clDisplay, 0, 2, 128, 6, VALUE_MIN, VALUE_MAX );
+}
+
+
+//**************************************************************************
+//	loop
+//--------------------------------------------------------------------------
+//	description
+//
+void loop()
+{
+	uint32_t	ulNow = millis();
+
+	if( SAMPLE_INTERVAL_MILLIS <= (ulNow - g_ulLastSample) )
+	{
+		g_ulLastSample = ulNow;
+
+		//------------------------------------------------------------------
+		//	a value that moves up and down between VALUE_MIN and VALUE_MAX
+		//
+		g_iValue += g_iStep;
+
+		if( VALUE_MAX < g_iValue )
+		{
+			g_iValue	= VALUE_MAX;
+			g_iStep		= -g_iStep;
+		}
+		else if( VALUE_MIN > g_iValue )
+		{
+			g_iValue	= VALUE_MIN;
+			g_iStep		= -g_iStep;
+		}
+
+		g_clSparkline.Add( g_iValue );
+		g_clBarGraph.SetValue( g_iValue );
+
+		g_clDisplay.PrintNumber( 0, 10, 6, g_iValue );
+	}
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		Arduino.h	(host build)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Minimal stand-in for the Arduino core, just enough to compile the
+//#	library and the examples on a Linux host.
+//#	The time functions do not use the real time. They return the
+//#	simulated time that is advanced by delay() and by every transmission
+//#	on the simulated I²C bus (see Wire.h).
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <avr/pgmspace.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define HIGH							1
+#define LOW								0
+
+#define INPUT							0
+#define OUTPUT							1
+#define INPUT_PULLUP					2
+
+class __FlashStringHelper;
+#define F( s )							(reinterpret_cast<const __FlashStringHelper *>( s ))
+
+typedef uint8_t		byte;
+typedef bool		boolean;
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+unsigned long	millis( void );
+unsigned long	micros( void );
+void			delay( unsigned long ulMillis );
+void			delayMicroseconds( unsigned int uiMicros );
+
+void			pinMode( uint8_t usPin, uint8_t usMode );
+void			digitalWrite( uint8_t usPin, uint8_t usValue );
+int				digitalRead( uint8_t usPin );
+
+//----	host only: simulated time in microseconds  -------------------------
+double			HostTime( void );
+void			HostAdvanceTime( double dMicros );
+
+//----	host only: level that was written to a pin  ------------------------
+uint8_t			HostPinLevel( uint8_t usPin );
+
+
+//==========================================================================
+//
+//		C L A S S E S
+//
+//	Like in the Arduino core the class Print is known to every sketch.
+//	The output of Serial goes to stdout.
+//
+//==========================================================================
+
+#include <Print.h>
+
+class HardwareSerial : public Print
+{
+	public:
+		void begin( unsigned long ulBaud );
+		size_t write( uint8_t usData );
+		using Print::write;
+		void flush( void );
+
+		operator bool()
+		{
+			return( true );
+		};
+};
+
+extern HardwareSerial	Serial;
@@ -0,0 +1,110 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		Print.h	(host build)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Stand-in for the class Print of the Arduino core.
+//#	The formatting works like on AVR: numbers are converted into a
+//#	buffer on the stack and written with write( buffer, size ),
+//#	single characters and flash strings with write( character ).
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define DEC								10
+#define HEX								16
+#define OCT								8
+#define BIN								2
+
+class __FlashStringHelper;
+class Print;
+
+
+//==========================================================================
+//
+//		C L A S S   D E F I N I T I O N S
+//
+//==========================================================================
+
+
+////////////////////////////////////////////////////////////////////////////
+//	CLASS: Printable
+//
+class Printable
+{
+	public:
+		virtual ~Printable() {};
+		virtual size_t printTo( Print &clPrint ) const = 0;
+};
+
+
+////////////////////////////////////////////////////////////////////////////
+//	CLASS: Print
+//
+class Print
+{
+	public:
+		virtual ~Print() {};
+
+		virtual size_t write( uint8_t usData ) = 0;
+		virtual size_t write( const uint8_t *pusBuffer, size_t uiSize );
+
+		size_t write( const char *pstrText )
+		{
+			return( (NULL == pstrText) ? 0 : write( (const uint8_t *)pstrText, strlen( pstrText ) ) );
+		};
+
+		size_t write( const char *pstrBuffer, size_t uiSize )
+		{
+			return( write( (const uint8_t *)pstrBuffer, uiSize ) );
+		};
+
+		virtual void flush( void ) {};
+
+		size_t print( const __FlashStringHelper *pstrText );
+		size_t print( const char *pstrText );
+		size_t print( char cValue );
+		size_t print( unsigned char usValue, int iBase = DEC );
+		size_t print( int iValue, int iBase = DEC );
+		size_t print( unsigned int uiValue, int iBase = DEC );
+		size_t print( long lValue, int iBase = DEC );
+		size_t print( unsigned long ulValue, int iBase = DEC );
+		size_t print( double dValue, int iDigits = 2 );
+		size_t print( const Printable &clValue );
+
+		size_t println( void );
+		size_t println( const __FlashStringHelper *pstrText );
+		size_t println( const char *pstrText );
+		size_t println( char cValue );
+		size_t println( unsigned char usValue, int iBase = DEC );
+		size_t println( int iValue, int iBase = DEC );
+		size_t println( unsigned int uiValue, int iBase = DEC );
+		size_t println( long lValue, int iBase = DEC );
+		size_t println( unsigned long ulValue, int iBase = DEC );
+		size_t println( double dValue, int iDigits = 2 );
+		size_t println( const Printable &clValue );
+
+	private:
+		size_t PrintNumber( unsigned long ulValue, uint8_t usBase );
+		size_t PrintFloat( double dValue, uint8_t usDigits );
+};
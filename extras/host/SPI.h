@@ -0,0 +1,107 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		SPI.h	(host build)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Stand-in for the Arduino SPI library.
+//#	While the chip select pin of the attached SH1106 model is 'low' every
+//#	transferred byte is handed over to the model as command or data,
+//#	depending on the level of the D/C pin.
+//#	The statistic counts the transactions (beginTransaction() ...
+//#	endTransaction()), the bytes and the simulated time on the bus.
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <Arduino.h>
+#include <Wire.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define LSBFIRST						0
+#define MSBFIRST						1
+
+#define SPI_MODE0						0x00
+#define SPI_MODE1						0x04
+#define SPI_MODE2						0x08
+#define SPI_MODE3						0x0C
+
+
+class Sh1106Model;
+
+
+//==========================================================================
+//
+//		C L A S S   D E F I N I T I O N S
+//
+//==========================================================================
+
+
+////////////////////////////////////////////////////////////////////////////
+//	CLASS: SPISettings
+//
+class SPISettings
+{
+	public:
+		SPISettings( uint32_t ulClock = 4000000UL, uint8_t usBitOrder = MSBFIRST, uint8_t usMode = SPI_MODE0 )
+		{
+			m_ulClock = ulClock;
+
+			(void)usBitOrder;
+			(void)usMode;
+		};
+
+		uint32_t	m_ulClock;
+};
+
+
+////////////////////////////////////////////////////////////////////////////
+//	CLASS: SPIClass
+//
+class SPIClass
+{
+	public:
+		SPIClass();
+
+		void	begin( void );
+		void	end( void );
+		void	beginTransaction( SPISettings clSettings );
+		void	endTransaction( void );
+		uint8_t	transfer( uint8_t usData );
+
+		//----	host only  -------------------------------------------------
+		void			Attach( Sh1106Model *pclModel, uint8_t usPinDC, uint8_t usPinCS );
+
+		WireStatistic	Statistic( void )	{ return( m_tStatistic ); };
+		void			ResetStatistic( void );
+
+	private:
+		Sh1106Model		*m_pclModel;
+		uint8_t			m_usPinDC;
+		uint8_t			m_usPinCS;
+		uint32_t		m_ulClock;
+		WireStatistic	m_tStatistic;
+};
+
+
+//==========================================================================
+//
+//		E X T E R N   G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+extern SPIClass	SPI;
@@ -0,0 +1,140 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		Wire.h	(host build)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Stand-in for the Arduino Wire library.
+//#	Every transmission is handed over to the SH1106 model that is
+//#	attached to the addressed device (see sh1106_model.h) and is counted
+//#	in the bus statistic together with the simulated time on the bus.
+//#
+//#	Like the AVR implementation the transmit buffer holds BUFFER_LENGTH
+//#	bytes. Bytes that do not fit into the buffer are dropped and counted
+//#	as overflow, so a wrong chunking of the library will be detected.
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <Arduino.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#ifndef BUFFER_LENGTH
+#define BUFFER_LENGTH					32
+#endif
+
+#define WIRE_MAX_DEVICES				4
+#define WIRE_DEFAULT_CLOCK				100000UL
+
+//----	like the AVR implementation the timeout can be set  ---------------
+#define WIRE_HAS_TIMEOUT
+
+
+//--------------------------------------------------------------------------
+//	Statistic of the simulated bus
+//
+//	One transmission on the bus consists of
+//		-	START condition				( 1 bit time)
+//		-	address byte plus ACK		( 9 bit times)
+//		-	each payload byte plus ACK	( 9 bit times)
+//		-	STOP condition				( 1 bit time)
+//
+struct WireStatistic
+{
+	uint32_t	ulTransactions;
+	uint32_t	ulPayloadBytes;
+	uint32_t	ulOverheadBits;
+	uint32_t	ulBits;
+	uint32_t	ulNacks;
+	uint32_t	ulOverflows;
+	double		dBusMicros;
+};
+
+
+class Sh1106Model;
+
+
+//==========================================================================
+//
+//		C L A S S   D E F I N I T I O N S
+//
+//==========================================================================
+
+
+////////////////////////////////////////////////////////////////////////////
+//	CLASS: TwoWire
+//
+class TwoWire
+{
+	public:
+		TwoWire();
+
+		void	begin( void );
+		void	end( void );
+		void	setClock( uint32_t ulClock );
+		void	setWireTimeout( uint32_t ulTimeout = 25000, bool bResetWithTimeout = false );
+
+		void	beginTransmission( uint8_t usAddress );
+		size_t	write( uint8_t usData );
+		size_t	write( const uint8_t *pusData, size_t uiLength );
+		uint8_t	endTransmission( bool bSendStop = true );
+
+		uint8_t	requestFrom( uint8_t usAddress, uint8_t usQuantity );
+		int		available( void );
+		int		read( void );
+
+		//----	host only  -------------------------------------------------
+		void			Attach( uint8_t usAddress, Sh1106Model *pclModel );
+		void			Detach( uint8_t usAddress );
+		Sh1106Model *	Device( uint8_t usAddress );
+
+		void			FailTransmissions( uint16_t uiCount, uint8_t usError = 2 );
+		void			SetMaxClock( uint32_t ulMaxClock );
+
+		uint32_t		Clock( void )	{ return( m_ulClock ); };
+		uint32_t		Timeout( void )	{ return( m_ulTimeout ); };
+
+		WireStatistic	Statistic( void )	{ return( m_tStatistic ); };
+		void			ResetStatistic( void );
+
+	private:
+		uint32_t		m_ulClock;
+		uint32_t		m_ulTimeout;
+		uint32_t		m_ulMaxClock;
+		uint16_t		m_uiFailCount;
+		uint8_t			m_usFailError;
+		uint8_t			m_usAddress;
+		uint8_t			m_arusBuffer[ BUFFER_LENGTH ];
+		uint16_t		m_uiLength;
+		uint8_t			m_arusRxData[ BUFFER_LENGTH ];
+		uint8_t			m_usRxIndex;
+		uint8_t			m_usRxAvailable;
+		uint8_t			m_arusDeviceAddress[ WIRE_MAX_DEVICES ];
+		Sh1106Model *	m_arpclDevice[ WIRE_MAX_DEVICES ];
+		WireStatistic	m_tStatistic;
+
+		void CountTransaction( uint16_t uiPayloadBytes );
+};
+
+
+//==========================================================================
+//
+//		E X T E R N   G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+extern TwoWire	Wire;
@@ -0,0 +1,42 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		avr/pgmspace.h	(host build)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Stand-in for the AVR program memory functions.
+//#	On the host there is only one address space, so PROGMEM data is read
+//#	like every other data.
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <string.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define PROGMEM
+#define PGM_P							const char *
+#define PSTR( s )						(s)
+
+#define pgm_read_byte( addr )			(*(const uint8_t *)(addr))
+#define pgm_read_word( addr )			(*(const uint16_t *)(addr))
+#define pgm_read_dword( addr )			(*(const uint32_t *)(addr))
+#define pgm_read_ptr( addr )			(*(void * const *)(addr))
+
+#define memcpy_P( dest, src, len )		memcpy( (dest), (src), (len) )
+#define strlen_P( str )					strlen( (str) )
@@ -0,0 +1,681 @@
+//##########################################################################
+//#
+//#		benchmark.cpp	(host build)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Measures the traffic on the bus for every public function of the
+//#	class SimpleDisplayClass and for the examples of the library.
+//#
+//#	The result is written as CSV to stdout, one line per scenario:
+//#		scenario		name of the measured operation
+//#		transactions	number of I²C transmissions
+//#		payload_bytes	bytes after the address byte (control + data)
+//#		overhead_bits	bits for START, address byte and STOP
+//#		total_bits		all bits on the bus
+//#		us_100k			time on the bus at 100 kHz
+//#		us_400k			time on the bus at 400 kHz
+//#		us_1m			time on the bus at 1 MHz
+//#		overflows		bytes that did not fit into the Wire buffer
+//#
+//#	With the SPI transport (SIMPLE_OLED_TRANSPORT_SPI) there are no
+//#	control bytes and no address or STOP on the bus, total_bits are the
+//#	clock cycles of the SPI bus.
+//#
+//#	Some scenarios also check the picture of the display, a failed
+//#	check is reported on stderr.
+//#
+//#	usage:	benchmark [filter]
+//#			only scenarios that contain 'filter' in their name are run
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SPI.h>
+
+#include "sh1106_model.h"
+#include "simple_oled_sh1106.h"
+#include "simple_oled_manager.h"
+#include "simple_oled_widgets.h"
+
+
+//==========================================================================
+//
+//		E X A M P L E S
+//
+//	The examples are compiled as they are, each in its own namespace.
+//
+//==========================================================================
+
+namespace ExamplePrintText
+{
+	#include "../../examples/PrintText/PrintText.ino"
+}
+
+namespace ExamplePrintMode
+{
+	#include "../../examples/PrintMode/PrintMode.ino"
+}
+
+namespace ExampleFlashFlipDisplay
+{
+	#include "../../examples/FlashFlipDisplay/FlashFlipDisplay.ino"
+}
+
+namespace ExampleMultiDisplay
+{
+	#include "../../examples/MultiDisplay/MultiDisplay.ino"
+}
+
+namespace ExampleDashboard
+{
+	#include "../../examples/Dashboard/Dashboard.ino"
+}
+
+namespace ExampleSmoothScroll
+{
+	#include "../../examples/SmoothScroll/SmoothScroll.ino"
+}
+
+namespace ExampleEventLog
+{
+	#include "../../examples/EventLog/EventLog.ino"
+}
+
+namespace ExampleGraphics
+{
+	#include "../../examples/Graphics/Graphics.ino"
+}
+
+namespace ExampleTrend
+{
+	#include "../../examples/Trend/Trend.ino"
+}
+
+namespace ExampleTrace
+{
+	#include "../../examples/Trace/Trace.ino"
+}
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define PM_SAME							0
+#define PM_NEXT							1
+#define PM_SCROLL						2
+
+typedef void (*ScenarioFunction)( void );
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+Sh1106Model		g_clPanel;
+Sh1106Model		g_clSecondPanel;
+
+const char		*g_pstrFilter	= NULL;
+uint32_t		g_ulOverflows	= 0;
+uint32_t		g_ulCheckErrors	= 0;
+
+SimpleOledSparkline	g_clSparkline;
+SimpleOledBarGraph	g_clBarGraph;
+
+const char		g_strLine[]		= "0123456789ABCDEF";
+const char		g_strLong[]		= "The quick brown fox jumps over the lazy dog";
+
+const uint8_t	g_arusBitmap[] PROGMEM	= {	0xFF, 0x81, 0xBD, 0xA5, 0xA5, 0xBD, 0x81, 0xFF,
+											0xFF, 0x81, 0xBD, 0xA5, 0xA5, 0xBD, 0x81, 0xFF };
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+//**************************************************************************
+//	Prepare
+//--------------------------------------------------------------------------
+//	Brings display and library into a defined state before a scenario.
+//
+static void Prepare( uint8_t usPrintMode )
+{
+	g_clPanel.Reset();
+	g_clSecondPanel.Reset();
+	g_clDisplay.Init();
+	g_clDisplay.SetSmoothScroll( false );
+	g_clDisplay.SetScrollRegion( 0, g_clDisplay.MaxTextLines() - 1 );
+
+	switch( usPrintMode )
+	{
+		case PM_SAME:	g_clDisplay.SetPrintModeOverwriteSameLine();	break;
+		case PM_NEXT:	g_clDisplay.SetPrintModeOverwriteNextLine();	break;
+		default:		g_clDisplay.SetPrintModeScrollLine();			break;
+	}
+}
+
+
+//**************************************************************************
+//	Report
+//--------------------------------------------------------------------------
+//	Writes the statistic of the bus since the last reset as one CSV line.
+//
+static void Report( const char *pstrScenario )
+{
+#if SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_SPI
+	WireStatistic	tStatistic = SPI.Statistic();
+#else
+	WireStatistic	tStatistic = Wire.Statistic();
+#endif
+
+	printf( "%s,%lu,%lu,%lu,%lu,%.1f,%.1f,%.1f,%lu",
+			pstrScenario,
+			(unsigned long)tStatistic.ulTransactions,
+			(unsigned long)tStatistic.ulPayloadBytes,
+			(unsigned long)tStatistic.ulOverheadBits,
+			(unsigned long)tStatistic.ulBits,
+			tStatistic.ulBits / 0.1,
+			tStatistic.ulBits / 0.4,
+			tStatistic.ulBits / 1.0,
+			(unsigned long)tStatistic.ulOverflows );
+
+#if SIMPLE_OLED_STATS
+	//----------------------------------------------------------------------
+	//	the statistics of the library for the first display
+	//
+	SimpleOledStats	tStats;
+
+	g_clDisplay.GetStats( &tStats );
+
+	printf( ",%lu,%lu,%lu,%lu",
+			(unsigned long)tStats.ulTransactions,
+			(unsigned long)tStats.ulPayloadBytes,
+			(unsigned long)tStats.ulAddressBytes,
+			(unsigned long)tStats.ulBusMicros );
+#endif
+
+	printf( "\n" );
+
+	g_ulOverflows += tStatistic.ulOverflows;
+}
+
+
+//**************************************************************************
+//	Run
+//--------------------------------------------------------------------------
+//	Prepares the display, runs the setup function of a scenario without
+//	counting, then runs and reports the measured function.
+//
+static void Run(	const char			*pstrScenario,
+					uint8_t				 usPrintMode,
+					ScenarioFunction	 pfSetup,
+					ScenarioFunction	 pfMeasure )
+{
+	if( (NULL != g_pstrFilter) && (NULL == strstr( pstrScenario, g_pstrFilter )) )
+	{
+		return;
+	}
+
+	Prepare( usPrintMode );
+
+	if( NULL != pfSetup )
+	{
+		pfSetup();
+	}
+
+	Wire.ResetStatistic();
+	SPI.ResetStatistic();
+	g_clDisplay.ResetStats();
+	pfMeasure();
+	Report( pstrScenario );
+}
+
+
+//--------------------------------------------------------------------------
+//	setup functions
+//
+static void CursorLastLine( void )		{ g_clDisplay.SetCursor( 7, 0 ); }
+static void CursorLineEnd( void )		{ g_clDisplay.SetCursor( 3, 12 ); }
+
+static void FullScreen( void )
+{
+	g_clDisplay.SetPrintModeOverwriteNextLine();
+	g_clDisplay.Home();
+
+	for( uint8_t idx = 0 ; idx < 8 ; idx++ )
+	{
+		g_clDisplay.Print( g_strLine );
+	}
+}
+
+static void StatusScreen( uint16_t uiValue )
+{
+	char	strBuffer[ 20 ];
+
+	g_clDisplay.SetCursor( 0, 0 );
+	g_clDisplay.Print( F( "Status screen" ) );
+	g_clDisplay.SetCursor( 2, 0 );
+	g_clDisplay.Print( F( "Speed:" ) );
+	sprintf( strBuffer, "%5u rpm", uiValue );
+	g_clDisplay.SetCursor( 2, 7 );
+	g_clDisplay.Print( strBuffer );
+	g_clDisplay.SetCursor( 4, 0 );
+	g_clDisplay.Print( F( "Voltage: 12.6 V" ) );
+	g_clDisplay.SetCursor( 6, 0 );
+	g_clDisplay.Print( F( "State:   running" ) );
+}
+
+static void StatusScreenFirst( void )	{ StatusScreen( 1234 ); }
+
+static void RegionLog( void )
+{
+	g_clDisplay.SetScrollRegion( 1, 6 );
+	g_clDisplay.Print( F( "Title" ) );
+	g_clDisplay.SetCursor( 7, 0 );
+	g_clDisplay.Print( F( "Status" ) );
+	g_clDisplay.SetCursor( 1, 0 );
+	g_clDisplay.Print( "event 1\nevent 2\nevent 3\nevent 4\nevent 5\nevent 6" );
+}
+
+//----	a title line and a status line around a scroll region  ------------
+//	independent of the font: the first and the last text line are fixed
+//
+static void RegionFixedLines( void )
+{
+	g_clDisplay.SetScrollRegion( 1, g_clDisplay.MaxTextLines() - 2 );
+	g_clDisplay.SetCursor( 0, 0 );
+	g_clDisplay.Print( F( "Title" ) );
+	g_clDisplay.SetCursor( g_clDisplay.MaxTextLines() - 1, 0 );
+	g_clDisplay.Print( F( "Status" ) );
+}
+
+static void SmoothScrollLastLine( void )
+{
+	g_clDisplay.SetSmoothScroll( true );
+	g_clDisplay.SetCursor( 7, 0 );
+}
+
+//----	the status screen as layout  ---------------------------------------
+static const char	g_strLayoutTitle[]		PROGMEM	= "Status screen";
+static const char	g_strLayoutSpeed[]		PROGMEM	= "Speed:";
+static const char	g_strLayoutRpm[]		PROGMEM	= "rpm";
+static const char	g_strLayoutVoltage[]	PROGMEM	= "Voltage:";
+static const char	g_strLayoutState[]		PROGMEM	= "State:";
+
+static const SimpleOledLabel	g_artLayoutLabels[] PROGMEM =
+{
+	{ 0,  0,	0,	g_strLayoutTitle	},
+	{ 2,  0,	0,	g_strLayoutSpeed	},
+	{ 2, 13,	0,	g_strLayoutRpm		},
+	{ 4,  0,	0,	g_strLayoutVoltage	},
+	{ 6,  0,	0,	g_strLayoutState	}
+};
+
+static const SimpleOledField	g_artLayoutFields[] PROGMEM =
+{
+	{ 2,  7,	5,	SIMPLE_OLED_ALIGN_RIGHT	},
+	{ 4,  9,	6,	SIMPLE_OLED_ALIGN_RIGHT	},
+	{ 6,  9,	7,	SIMPLE_OLED_ALIGN_LEFT	}
+};
+
+static const SimpleOledLayout	g_tStatusLayout PROGMEM =
+{
+	g_artLayoutLabels,	5,
+	g_artLayoutFields,	3
+};
+
+static void StatusFields( uint16_t uiValue )
+{
+	g_clDisplay.SetFieldNumber( 0, uiValue );
+	g_clDisplay.SetFieldNumber( 1, 126, 1 );
+	g_clDisplay.SetField( 2, F( "running" ) );
+}
+
+static void StatusLayoutFirst( void )
+{
+	g_clDisplay.ShowLayout( &g_tStatusLayout );
+	StatusFields( 1234 );
+}
+
+
+//--------------------------------------------------------------------------
+//	measured functions
+//
+static void OpInit( void )				{ g_clDisplay.Init(); }
+static void OpClear( void )				{ g_clDisplay.Clear(); }
+static void OpClearLine( void )			{ g_clDisplay.ClearLine( 3 ); }
+static void OpSetCursor( void )			{ g_clDisplay.SetCursor( 3, 5 ); }
+static void OpHome( void )				{ g_clDisplay.Home(); }
+static void OpPrintChar( void )			{ g_clDisplay.PrintChar( 'A' ); }
+static void OpPrintLine( void )			{ g_clDisplay.Print( g_strLine ); }
+static void OpPrintLineFlash( void )	{ g_clDisplay.Print( F( "0123456789ABCDEF" ) ); }
+static void OpPrintLn( void )			{ g_clDisplay.PrintLn( "Hello" ); }
+static void OpPrintWrap( void )			{ g_clDisplay.Print( g_strLong ); }
+static void OpPrintNewLines( void )		{ g_clDisplay.Print( "one\ntwo\nthree\n" ); }
+static void OpSetInverse( void )		{ g_clDisplay.SetInverse( true ); }
+static void OpSetNormal( void )			{ g_clDisplay.SetInverse( false ); }
+static void OpFlipOn( void )			{ g_clDisplay.Flip( true ); }
+static void OpFlipOff( void )			{ g_clDisplay.Flip( false ); }
+static void OpColumnOffset( void )		{ g_clDisplay.SetDisplayColumnOffset( 1 ); }
+static void OpFullScreen( void )		{ FullScreen(); }
+static void OpStatusScreenSame( void )	{ StatusScreen( 1234 ); }
+static void OpStatusScreenDigit( void )	{ StatusScreen( 1235 ); }
+static void OpStatusLayout( void )		{ StatusLayoutFirst(); }
+
+static void OpScrollRegion( void )		{ g_clDisplay.Print( "\nevent 7" ); }
+
+static void OpNewLineFixedLine( void )
+{
+	uint8_t	usTitleRows = SH1106_ROWS / g_clDisplay.MaxTextLines();
+	bool	arbTitle[ SH1106_ROWS ][ SH1106_COLUMNS ];
+	bool	bChanged = false;
+
+	for( uint8_t usY = 0 ; usY < usTitleRows ; usY++ )
+	{
+		for( uint8_t usX = 0 ; usX < SH1106_COLUMNS ; usX++ )
+		{
+			arbTitle[ usY ][ usX ] = g_clPanel.Pixel( usX, usY );
+		}
+	}
+
+	//----------------------------------------------------------------------
+	//	a new line and a wrap in the status line must stay in that line,
+	//	the title line must not change
+	//
+	g_clDisplay.PrintLn( " ok" );
+	g_clDisplay.Print( g_strLong );
+
+	for( uint8_t usY = 0 ; usY < usTitleRows ; usY++ )
+	{
+		for( uint8_t usX = 0 ; usX < SH1106_COLUMNS ; usX++ )
+		{
+			bChanged |= (arbTitle[ usY ][ usX ] != g_clPanel.Pixel( usX, usY ));
+		}
+	}
+
+	if( bChanged )
+	{
+		fprintf( stderr, "print_newline_fixed_line: the title line has changed\n" );
+		g_ulCheckErrors++;
+	}
+}
+
+static void OpScrollSmooth( void )
+{
+	g_clDisplay.PrintLn( "smooth" );
+
+	//----------------------------------------------------------------------
+	//	the steps of one text line
+	//
+	while( g_clDisplay.IsScrolling() )
+	{
+		HostAdvanceTime( SIMPLE_OLED_SCROLL_STEP_MILLIS * 1000.0 );
+		g_clDisplay.Update();
+	}
+}
+static void OpFillAligned( void )		{ g_clDisplay.FillRect( 0, 16, 128, 16 ); }
+static void OpFillUnaligned( void )		{ g_clDisplay.FillRect( 0, 12, 128, 16 ); }
+static void OpDrawPixel( void )			{ g_clDisplay.DrawPixel( 64, 33 ); }
+static void OpDrawRect( void )			{ g_clDisplay.DrawRect( 10, 10, 100, 40 ); }
+static void OpBitmapAligned( void )		{ g_clDisplay.DrawBitmap( 60, 16, 8, 16, g_arusBitmap ); }
+static void OpBitmapUnaligned( void )	{ g_clDisplay.DrawBitmap( 60, 20, 8, 16, g_arusBitmap ); }
+
+static void SparklineHalf( void )
+{
+	g_clSparkline.Init( g_clDisplay, 0, 2, 128, 6, 0, 1000 );
+
+	for( uint8_t idx = 0 ; idx < 64 ; idx++ )
+	{
+		g_clSparkline.Add( idx * 15 );
+	}
+}
+
+static void BarGraphHalf( void )
+{
+	g_clBarGraph.Init( g_clDisplay, 0, 1, 128, 1, 0, 1000 );
+	g_clBarGraph.SetValue( 500 );
+}
+
+static void OpSparklineSample( void )	{ g_clSparkline.Add( 400 ); }
+static void OpBarGraphStep( void )		{ g_clBarGraph.SetValue( 530 ); }
+
+#if SIMPLE_OLED_FRAMEBUFFER
+static void RefreshRate( void )			{ g_clDisplay.SetRefreshRate( 10 ); }
+#endif
+
+static void OpPrintCounter( void )
+{
+	//----------------------------------------------------------------------
+	//	one second: a counter printed every 5 ms, Update() every ms
+	//
+	for( uint16_t idx = 0 ; idx < 1000 ; idx++ )
+	{
+		HostAdvanceTime( 1000.0 );
+
+		if( 0 == (idx % 5) )
+		{
+			g_clDisplay.PrintNumber( 2, 8, 6, idx );
+		}
+
+		g_clDisplay.Update();
+	}
+}
+
+static void OpStatusLayoutSame( void )	{ StatusFields( 1234 ); }
+static void OpStatusLayoutDigit( void )	{ StatusFields( 1235 ); }
+
+static void OpStockPrintInt( void )		{ g_clDisplay.print( -12345 ); }
+static void OpStockPrintFloat( void )	{ g_clDisplay.println( 3.14159, 3 ); }
+
+static void NumberField( void )			{ g_clDisplay.PrintNumber( 2, 8, 6, 1234 ); }
+static void OpNumberField( void )		{ g_clDisplay.PrintNumber( 2, 8, 6, 1234 ); }
+static void OpNumberFieldDigit( void )	{ g_clDisplay.PrintNumber( 2, 8, 6, 1235 ); }
+static void OpFixedField( void )		{ g_clDisplay.PrintFixed( 4, 8, 7, -1263, 2 ); }
+
+static void OpPrintInverse( void )
+{
+	g_clDisplay.SetInverseFont( true );
+	g_clDisplay.Print( g_strLine );
+	g_clDisplay.SetInverseFont( false );
+}
+
+static void OpScrollLines( void )
+{
+	for( uint8_t idx = 0 ; idx < 8 ; idx++ )
+	{
+		g_clDisplay.PrintLn( "scroll" );
+	}
+}
+
+static void ExPrintTextSetup( void )		{ ExamplePrintText::setup(); }
+static void ExPrintTextLoop( void )			{ ExamplePrintText::loop(); }
+static void ExPrintModeSetup( void )		{ ExamplePrintMode::setup(); }
+static void ExPrintModeLoop( void )			{ ExamplePrintMode::loop(); }
+static void ExFlashFlipSetup( void )		{ ExampleFlashFlipDisplay::setup(); }
+static void ExFlashFlipLoop( void )			{ ExampleFlashFlipDisplay::loop(); }
+static void ExMultiDisplaySetup( void )		{ ExampleMultiDisplay::setup(); }
+static void ExMultiDisplayLoop( void )		{ ExampleMultiDisplay::loop(); }
+static void ExDashboardSetup( void )		{ ExampleDashboard::setup(); }
+static void ExDashboardLoop( void )			{ ExampleDashboard::loop(); }
+static void ExSmoothScrollSetup( void )		{ ExampleSmoothScroll::setup(); }
+static void ExEventLogSetup( void )			{ ExampleEventLog::setup(); }
+static void ExGraphicsSetup( void )			{ ExampleGraphics::setup(); }
+static void ExTrendSetup( void )			{ ExampleTrend::setup(); }
+static void ExTraceSetup( void )			{ ExampleTrace::setup(); }
+
+static void ExTrendLoop( void )
+{
+	for( uint16_t idx = 0 ; idx < 1000 ; idx++ )
+	{
+		HostAdvanceTime( 1000.0 );
+		ExampleTrend::loop();
+	}
+}
+
+static void ExTraceLoop( void )
+{
+	for( uint16_t idx = 0 ; idx < 1000 ; idx++ )
+	{
+		HostAdvanceTime( 1000.0 );
+		ExampleTrace::loop();
+	}
+}
+
+static void ExGraphicsLoop( void )
+{
+	for( uint16_t idx = 0 ; idx < 1000 ; idx++ )
+	{
+		HostAdvanceTime( 1000.0 );
+		ExampleGraphics::loop();
+	}
+}
+
+static void ExEventLogLoop( void )
+{
+	for( uint16_t idx = 0 ; idx < 4000 ; idx++ )
+	{
+		HostAdvanceTime( 1000.0 );
+		ExampleEventLog::loop();
+	}
+}
+
+static void ExSmoothScrollLoop( void )
+{
+	//----------------------------------------------------------------------
+	//	two log lines and all steps of the scroll
+	//
+	for( uint16_t idx = 0 ; idx < 1000 ; idx++ )
+	{
+		HostAdvanceTime( 1000.0 );
+		ExampleSmoothScroll::loop();
+	}
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	static const char	*arpstrMode[]	= { "same", "next", "scroll" };
+	static const char	*arpstrPrint[]	= { "print_line", "print_line_flash", "print_wrap", "print_newlines", "println", "println_last_line", "print_line_end", "print_scroll_8_lines" };
+	char				strName[ 64 ];
+
+	if( 1 < argc )
+	{
+		g_pstrFilter = argv[ 1 ];
+	}
+
+	Wire.Attach( DISPLAY_ADDRESS, &g_clPanel );
+	Wire.Attach( SECOND_DISPLAY_ADDRESS, &g_clSecondPanel );
+#if SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_SPI
+	SPI.Attach( &g_clPanel, SIMPLE_OLED_SPI_PIN_DC, SIMPLE_OLED_SPI_PIN_CS );
+#endif
+
+	printf( "scenario,transactions,payload_bytes,overhead_bits,total_bits,us_100k,us_400k,us_1m,overflows" );
+#if SIMPLE_OLED_STATS
+	printf( ",lib_transactions,lib_payload_bytes,lib_address_bytes,lib_bus_us" );
+#endif
+	printf( "\n" );
+
+	Run( "init",				PM_SCROLL,	NULL,				OpInit );
+	Run( "clear",				PM_SCROLL,	NULL,				OpClear );
+	Run( "clear_line",			PM_SCROLL,	NULL,				OpClearLine );
+	Run( "set_cursor",			PM_SCROLL,	NULL,				OpSetCursor );
+	Run( "home",				PM_SCROLL,	NULL,				OpHome );
+	Run( "print_char",			PM_SCROLL,	NULL,				OpPrintChar );
+	Run( "print_inverse_font",	PM_SCROLL,	NULL,				OpPrintInverse );
+	Run( "set_inverse_on",		PM_SCROLL,	NULL,				OpSetInverse );
+	Run( "set_inverse_off",		PM_SCROLL,	NULL,				OpSetNormal );
+	Run( "flip_on",				PM_SCROLL,	NULL,				OpFlipOn );
+	Run( "flip_off",			PM_SCROLL,	NULL,				OpFlipOff );
+	Run( "column_offset",		PM_SCROLL,	NULL,				OpColumnOffset );
+
+	for( uint8_t usMode = PM_SAME ; usMode <= PM_SCROLL ; usMode++ )
+	{
+		ScenarioFunction	arpfSetup[]		= { NULL, NULL, NULL, NULL, NULL, CursorLastLine, CursorLineEnd, CursorLastLine };
+		ScenarioFunction	arpfMeasure[]	= { OpPrintLine, OpPrintLineFlash, OpPrintWrap, OpPrintNewLines, OpPrintLn, OpPrintLn, OpPrintWrap, OpScrollLines };
+
+		for( uint8_t idx = 0 ; idx < sizeof( arpstrPrint ) / sizeof( arpstrPrint[ 0 ] ) ; idx++ )
+		{
+			snprintf( strName, sizeof( strName ), "%s_%s", arpstrPrint[ idx ], arpstrMode[ usMode ] );
+			Run( strName, usMode, arpfSetup[ idx ], arpfMeasure[ idx ] );
+		}
+	}
+
+	Run( "stock_print_int",				PM_SCROLL,	NULL,				OpStockPrintInt );
+	Run( "stock_print_float",			PM_SCROLL,	NULL,				OpStockPrintFloat );
+
+	Run( "number_field",				PM_SCROLL,	NULL,				OpNumberField );
+	Run( "number_field_one_digit",		PM_SCROLL,	NumberField,		OpNumberFieldDigit );
+	Run( "fixed_field",					PM_SCROLL,	NULL,				OpFixedField );
+
+	Run( "full_screen",					PM_NEXT,	NULL,				OpFullScreen );
+	Run( "full_screen_reprint",			PM_NEXT,	FullScreen,			OpFullScreen );
+	Run( "status_screen",				PM_SCROLL,	NULL,				OpStatusScreenSame );
+	Run( "status_screen_reprint",		PM_SCROLL,	StatusScreenFirst,	OpStatusScreenSame );
+	Run( "status_screen_one_digit",		PM_SCROLL,	StatusScreenFirst,	OpStatusScreenDigit );
+	Run( "status_layout",				PM_SCROLL,	NULL,				OpStatusLayout );
+	Run( "status_layout_reprint",		PM_SCROLL,	StatusLayoutFirst,	OpStatusLayoutSame );
+	Run( "status_layout_one_digit",		PM_SCROLL,	StatusLayoutFirst,	OpStatusLayoutDigit );
+
+	Run( "print_scroll_smooth",			PM_SCROLL,	SmoothScrollLastLine,	OpScrollSmooth );
+	Run( "print_scroll_region",			PM_SCROLL,	RegionLog,			OpScrollRegion );
+	Run( "print_newline_fixed_line",	PM_SCROLL,	RegionFixedLines,	OpNewLineFixedLine );
+
+	Run( "graphics_fill_aligned",		PM_SCROLL,	NULL,				OpFillAligned );
+	Run( "graphics_fill_unaligned",		PM_SCROLL,	NULL,				OpFillUnaligned );
+	Run( "graphics_pixel",				PM_SCROLL,	NULL,				OpDrawPixel );
+	Run( "graphics_rect",				PM_SCROLL,	NULL,				OpDrawRect );
+	Run( "graphics_bitmap_aligned",		PM_SCROLL,	NULL,				OpBitmapAligned );
+	Run( "graphics_bitmap_unaligned",	PM_SCROLL,	NULL,				OpBitmapUnaligned );
+	Run( "print_counter_200hz",			PM_SCROLL,	NULL,				OpPrintCounter );
+#if SIMPLE_OLED_FRAMEBUFFER
+	//----------------------------------------------------------------------
+	//	the refresh rate needs the framebuffer, without it the scenario
+	//	would only repeat print_counter_200hz
+	//
+	Run( "print_counter_200hz_10fps",	PM_SCROLL,	RefreshRate,		OpPrintCounter );
+#endif
+	Run( "sparkline_sample",			PM_SCROLL,	SparklineHalf,		OpSparklineSample );
+	Run( "bar_graph_step",				PM_SCROLL,	BarGraphHalf,		OpBarGraphStep );
+
+	Run( "example_PrintText_setup",			PM_SCROLL,	NULL,				ExPrintTextSetup );
+	Run( "example_PrintText_loop",			PM_SCROLL,	ExPrintTextSetup,	ExPrintTextLoop );
+	Run( "example_PrintMode_setup",			PM_SCROLL,	NULL,				ExPrintModeSetup );
+	Run( "example_PrintMode_loop",			PM_SCROLL,	ExPrintModeSetup,	ExPrintModeLoop );
+	Run( "example_FlashFlipDisplay_setup",	PM_SCROLL,	NULL,				ExFlashFlipSetup );
+	Run( "example_FlashFlipDisplay_loop",	PM_SCROLL,	ExFlashFlipSetup,	ExFlashFlipLoop );
+	Run( "example_MultiDisplay_setup",		PM_SCROLL,	NULL,				ExMultiDisplaySetup );
+	Run( "example_MultiDisplay_loop",		PM_SCROLL,	ExMultiDisplaySetup,	ExMultiDisplayLoop );
+	Run( "example_Dashboard_setup",			PM_SCROLL,	NULL,				ExDashboardSetup );
+	Run( "example_Dashboard_loop",			PM_SCROLL,	ExDashboardSetup,	ExDashboardLoop );
+	Run( "example_SmoothScroll_setup",		PM_SCROLL,	NULL,				ExSmoothScrollSetup );
+	Run( "example_SmoothScroll_loop",		PM_SCROLL,	ExSmoothScrollSetup,	ExSmoothScrollLoop );
+	Run( "example_EventLog_setup",			PM_SCROLL,	NULL,				ExEventLogSetup );
+	Run( "example_EventLog_loop",			PM_SCROLL,	ExEventLogSetup,	ExEventLogLoop );
+	Run( "example_Graphics_setup",			PM_SCROLL,	NULL,				ExGraphicsSetup );
+	Run( "example_Graphics_loop",			PM_SCROLL,	ExGraphicsSetup,	ExGraphicsLoop );
+	Run( "example_Trend_setup",				PM_SCROLL,	NULL,				ExTrendSetup );
+	Run( "example_Trend_loop",				PM_SCROLL,	ExTrendSetup,		ExTrendLoop );
+	Run( "example_Trace_setup",				PM_SCROLL,	NULL,				ExTraceSetup );
+	Run( "example_Trace_loop",				PM_SCROLL,	ExTraceSetup,		ExTraceLoop );
+
+	return( ((0 == g_ulOverflows) && (0 == g_ulCheckErrors)) ? 0 : 1 );
+}
@@ -0,0 +1,604 @@
+//##########################################################################
+//#
+//#		host_arduino.cpp	(host build)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Implementation of the Arduino stand-ins (see Arduino.h and Wire.h).
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SPI.h>
+
+#include "sh1106_model.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define BITS_PER_BYTE_WITH_ACK			9
+#define BITS_START_STOP					2
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+TwoWire			Wire;
+SPIClass		SPI;
+HardwareSerial	Serial;
+
+double			g_dHostMicros	= 0.0;
+uint8_t			g_arusPinLevel[ 256 ];
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+double HostTime( void )
+{
+	return( g_dHostMicros );
+}
+
+void HostAdvanceTime( double dMicros )
+{
+	g_dHostMicros += dMicros;
+}
+
+unsigned long millis( void )
+{
+	return( (unsigned long)(g_dHostMicros / 1000.0) );
+}
+
+unsigned long micros( void )
+{
+	return( (unsigned long)g_dHostMicros );
+}
+
+void delay( unsigned long ulMillis )
+{
+	g_dHostMicros += 1000.0 * ulMillis;
+}
+
+void delayMicroseconds( unsigned int uiMicros )
+{
+	g_dHostMicros += uiMicros;
+}
+
+void pinMode( uint8_t, uint8_t )
+{
+}
+
+void digitalWrite( uint8_t usPin, uint8_t usValue )
+{
+	g_arusPinLevel[ usPin ] = usValue;
+}
+
+uint8_t HostPinLevel( uint8_t usPin )
+{
+	return( g_arusPinLevel[ usPin ] );
+}
+
+int digitalRead( uint8_t )
+{
+	return( HIGH );
+}
+
+
+////////////////////////////////////////////////////////////////////////////
+//
+//	CLASS: TwoWire
+//
+
+TwoWire::TwoWire()
+{
+	m_ulClock		= WIRE_DEFAULT_CLOCK;
+	m_ulTimeout		= 0;
+	m_ulMaxClock	= 0;
+	m_uiFailCount	= 0;
+	m_usFailError	= 0;
+	m_usAddress		= 0;
+	m_uiLength		= 0;
+	m_usRxIndex		= 0;
+	m_usRxAvailable	= 0;
+
+	for( uint8_t idx = 0 ; idx < WIRE_MAX_DEVICES ; idx++ )
+	{
+		m_arusDeviceAddress[ idx ]	= 0;
+		m_arpclDevice[ idx ]		= NULL;
+	}
+
+	ResetStatistic();
+}
+
+void TwoWire::begin( void )
+{
+	m_ulClock = WIRE_DEFAULT_CLOCK;
+}
+
+void TwoWire::end( void )
+{
+}
+
+void TwoWire::setClock( uint32_t ulClock )
+{
+	m_ulClock = ulClock;
+}
+
+void TwoWire::setWireTimeout( uint32_t ulTimeout, bool bResetWithTimeout )
+{
+	(void)bResetWithTimeout;
+
+	m_ulTimeout = ulTimeout;
+}
+
+void TwoWire::beginTransmission( uint8_t usAddress )
+{
+	m_usAddress	= usAddress;
+	m_uiLength	= 0;
+}
+
+size_t TwoWire::write( uint8_t usData )
+{
+	if( BUFFER_LENGTH <= m_uiLength )
+	{
+		m_tStatistic.ulOverflows++;
+		return( 0 );
+	}
+
+	m_arusBuffer[ m_uiLength++ ] = usData;
+
+	return( 1 );
+}
+
+size_t TwoWire::write( const uint8_t *pusData, size_t uiLength )
+{
+	size_t	uiWritten = 0;
+
+	while( uiLength-- )
+	{
+		uiWritten += write( *pusData++ );
+	}
+
+	return( uiWritten );
+}
+
+//--------------------------------------------------------------------------
+//	return values like the Arduino implementation
+//		0:	success
+//		2:	NACK on transmit of address
+//	the next transmissions fail with a given error if requested (see
+//	FailTransmissions()), above the highest clock of the bus the display
+//	does not answer (see SetMaxClock())
+//
+uint8_t TwoWire::endTransmission( bool bSendStop )
+{
+	Sh1106Model	*pclModel = Device( m_usAddress );
+
+	(void)bSendStop;
+
+	if( (0 < m_ulMaxClock) && (m_ulMaxClock < m_ulClock) )
+	{
+		pclModel = NULL;
+	}
+
+	if( 0 < m_uiFailCount )
+	{
+		CountTransaction( 0 );
+		m_tStatistic.ulNacks++;
+		m_uiFailCount--;
+		m_uiLength = 0;
+
+		return( m_usFailError );
+	}
+
+	if( NULL == pclModel )
+	{
+		//------------------------------------------------------------------
+		//	nobody answers, only the address byte is on the bus
+		//
+		CountTransaction( 0 );
+		m_tStatistic.ulNacks++;
+		m_uiLength = 0;
+
+		return( 2 );
+	}
+
+	CountTransaction( m_uiLength );
+	pclModel->Transaction( m_arusBuffer, m_uiLength );
+	m_uiLength = 0;
+
+	return( 0 );
+}
+
+//--------------------------------------------------------------------------
+//	a read from the sh1106 returns the status byte or the display RAM,
+//	depending on the control byte of the transmission before
+//
+uint8_t TwoWire::requestFrom( uint8_t usAddress, uint8_t usQuantity )
+{
+	Sh1106Model	*pclModel = Device( usAddress );
+
+	if( (0 < m_ulMaxClock) && (m_ulMaxClock < m_ulClock) )
+	{
+		pclModel = NULL;
+	}
+
+#if BUFFER_LENGTH < 256
+	//----------------------------------------------------------------------
+	//	like the AVR implementation at most BUFFER_LENGTH bytes are read
+	//
+	if( BUFFER_LENGTH < usQuantity )
+	{
+		usQuantity = BUFFER_LENGTH;
+	}
+#endif
+
+	CountTransaction( pclModel ? usQuantity : 0 );
+
+	if( (NULL == pclModel) || (0 == usQuantity) )
+	{
+		m_tStatistic.ulNacks++;
+		m_usRxAvailable = 0;
+
+		return( 0 );
+	}
+
+	for( uint8_t idx = 0 ; idx < usQuantity ; idx++ )
+	{
+		m_arusRxData[ idx ] = pclModel->Read();
+	}
+
+	m_usRxIndex		= 0;
+	m_usRxAvailable	= usQuantity;
+
+	return( usQuantity );
+}
+
+int TwoWire::available( void )
+{
+	return( m_usRxAvailable );
+}
+
+int TwoWire::read( void )
+{
+	if( 0 == m_usRxAvailable )
+	{
+		return( -1 );
+	}
+
+	m_usRxAvailable--;
+
+	return( m_arusRxData[ m_usRxIndex++ ] );
+}
+
+void TwoWire::Attach( uint8_t usAddress, Sh1106Model *pclModel )
+{
+	Detach( usAddress );
+
+	for( uint8_t idx = 0 ; idx < WIRE_MAX_DEVICES ; idx++ )
+	{
+		if( NULL == m_arpclDevice[ idx ] )
+		{
+			m_arusDeviceAddress[ idx ]	= usAddress;
+			m_arpclDevice[ idx ]		= pclModel;
+			return;
+		}
+	}
+}
+
+void TwoWire::Detach( uint8_t usAddress )
+{
+	for( uint8_t idx = 0 ; idx < WIRE_MAX_DEVICES ; idx++ )
+	{
+		if( (NULL != m_arpclDevice[ idx ]) && (usAddress == m_arusDeviceAddress[ idx ]) )
+		{
+			m_arpclDevice[ idx ] = NULL;
+		}
+	}
+}
+
+//--------------------------------------------------------------------------
+//	the next uiCount transmissions fail with usError (fault injection)
+//
+void TwoWire::FailTransmissions( uint16_t uiCount, uint8_t usError )
+{
+	m_uiFailCount	= uiCount;
+	m_usFailError	= usError;
+}
+
+//--------------------------------------------------------------------------
+//	highest clock that works on the simulated bus, '0' = no limit
+//
+void TwoWire::SetMaxClock( uint32_t ulMaxClock )
+{
+	m_ulMaxClock = ulMaxClock;
+}
+
+Sh1106Model * TwoWire::Device( uint8_t usAddress )
+{
+	for( uint8_t idx = 0 ; idx < WIRE_MAX_DEVICES ; idx++ )
+	{
+		if( (NULL != m_arpclDevice[ idx ]) && (usAddress == m_arusDeviceAddress[ idx ]) )
+		{
+			return( m_arpclDevice[ idx ] );
+		}
+	}
+
+	return( NULL );
+}
+
+void TwoWire::ResetStatistic( void )
+{
+	memset( &m_tStatistic, 0, sizeof( m_tStatistic ) );
+}
+
+//--------------------------------------------------------------------------
+//	count one transmission and advance the simulated time
+//
+void TwoWire::CountTransaction( uint16_t uiPayloadBytes )
+{
+	uint32_t	ulOverhead	= BITS_START_STOP + BITS_PER_BYTE_WITH_ACK;
+	uint32_t	ulBits		= ulOverhead + BITS_PER_BYTE_WITH_ACK * uiPayloadBytes;
+	double		dMicros		= (1000000.0 * ulBits) / m_ulClock;
+
+	m_tStatistic.ulTransactions++;
+	m_tStatistic.ulPayloadBytes	+= uiPayloadBytes;
+	m_tStatistic.ulOverheadBits	+= ulOverhead;
+	m_tStatistic.ulBits			+= ulBits;
+	m_tStatistic.dBusMicros		+= dMicros;
+
+	HostAdvanceTime( dMicros );
+}
+
+
+////////////////////////////////////////////////////////////////////////////
+//
+//	CLASS: SPIClass
+//
+
+SPIClass::SPIClass()
+{
+	m_pclModel	= NULL;
+	m_usPinDC	= 0;
+	m_usPinCS	= 0;
+	m_ulClock	= 4000000UL;
+
+	ResetStatistic();
+}
+
+void SPIClass::begin( void )
+{
+}
+
+void SPIClass::end( void )
+{
+}
+
+void SPIClass::beginTransaction( SPISettings clSettings )
+{
+	m_ulClock = clSettings.m_ulClock;
+
+	m_tStatistic.ulTransactions++;
+}
+
+void SPIClass::endTransaction( void )
+{
+}
+
+//--------------------------------------------------------------------------
+//	the display only reads the byte if its chip select is active
+//
+uint8_t SPIClass::transfer( uint8_t usData )
+{
+	double	dMicros = (1000000.0 * 8) / m_ulClock;
+
+	m_tStatistic.ulPayloadBytes++;
+	m_tStatistic.ulBits		+= 8;
+	m_tStatistic.dBusMicros	+= dMicros;
+
+	HostAdvanceTime( dMicros );
+
+	if( (NULL != m_pclModel) && (LOW == HostPinLevel( m_usPinCS )) )
+	{
+		m_pclModel->SpiWrite( HIGH == HostPinLevel( m_usPinDC ), usData );
+	}
+
+	return( 0xFF );
+}
+
+void SPIClass::Attach( Sh1106Model *pclModel, uint8_t usPinDC, uint8_t usPinCS )
+{
+	m_pclModel	= pclModel;
+	m_usPinDC	= usPinDC;
+	m_usPinCS	= usPinCS;
+}
+
+void SPIClass::ResetStatistic( void )
+{
+	memset( &m_tStatistic, 0, sizeof( m_tStatistic ) );
+}
+
+
+////////////////////////////////////////////////////////////////////////////
+//
+//	CLASS: HardwareSerial
+//
+
+void HardwareSerial::begin( unsigned long )
+{
+}
+
+size_t HardwareSerial::write( uint8_t usData )
+{
+	return( (EOF == putchar( usData )) ? 0 : 1 );
+}
+
+void HardwareSerial::flush( void )
+{
+	fflush( stdout );
+}
+
+
+////////////////////////////////////////////////////////////////////////////
+//
+//	CLASS: Print
+//
+
+size_t Print::write( const uint8_t *pusBuffer, size_t uiSize )
+{
+	size_t	uiWritten = 0;
+
+	while( 0 < uiSize-- )
+	{
+		uiWritten += write( *pusBuffer++ );
+	}
+
+	return( uiWritten );
+}
+
+size_t Print::print( const __FlashStringHelper *pstrText )
+{
+	PGM_P	pText		= reinterpret_cast<PGM_P>( pstrText );
+	size_t	uiWritten	= 0;
+	uint8_t	usData		= pgm_read_byte( pText++ );
+
+	while( 0 != usData )
+	{
+		uiWritten	+= write( usData );
+		usData		 = pgm_read_byte( pText++ );
+	}
+
+	return( uiWritten );
+}
+
+size_t Print::print( const char *pstrText )					{ return( write( pstrText ) ); }
+size_t Print::print( char cValue )							{ return( write( (uint8_t)cValue ) ); }
+size_t Print::print( unsigned char usValue, int iBase )		{ return( print( (unsigned long)usValue, iBase ) ); }
+size_t Print::print( int iValue, int iBase )				{ return( print( (long)iValue, iBase ) ); }
+size_t Print::print( unsigned int uiValue, int iBase )		{ return( print( (unsigned long)uiValue, iBase ) ); }
+size_t Print::print( double dValue, int iDigits )			{ return( PrintFloat( dValue, iDigits ) ); }
+size_t Print::print( const Printable &clValue )				{ return( clValue.printTo( *this ) ); }
+
+size_t Print::print( long lValue, int iBase )
+{
+	if( (10 == iBase) && (0 > lValue) )
+	{
+		size_t	uiWritten = print( '-' );
+
+		return( uiWritten + PrintNumber( (unsigned long)(-lValue), 10 ) );
+	}
+
+	return( PrintNumber( (unsigned long)lValue, iBase ) );
+}
+
+size_t Print::print( unsigned long ulValue, int iBase )
+{
+	return( PrintNumber( ulValue, iBase ) );
+}
+
+size_t Print::println( void )								{ return( write( "\r\n" ) ); }
+size_t Print::println( const __FlashStringHelper *pstrText )	{ size_t n = print( pstrText );			return( n + println() ); }
+size_t Print::println( const char *pstrText )				{ size_t n = print( pstrText );			return( n + println() ); }
+size_t Print::println( char cValue )						{ size_t n = print( cValue );			return( n + println() ); }
+size_t Print::println( unsigned char usValue, int iBase )	{ size_t n = print( usValue, iBase );	return( n + println() ); }
+size_t Print::println( int iValue, int iBase )				{ size_t n = print( iValue, iBase );	return( n + println() ); }
+size_t Print::println( unsigned int uiValue, int iBase )	{ size_t n = print( uiValue, iBase );	return( n + println() ); }
+size_t Print::println( long lValue, int iBase )				{ size_t n = print( lValue, iBase );	return( n + println() ); }
+size_t Print::println( unsigned long ulValue, int iBase )	{ size_t n = print( ulValue, iBase );	return( n + println() ); }
+size_t Print::println( double dValue, int iDigits )			{ size_t n = print( dValue, iDigits );	return( n + println() ); }
+size_t Print::println( const Printable &clValue )			{ size_t n = print( clValue );			return( n + println() ); }
+
+//--------------------------------------------------------------------------
+//	like on AVR: the digits are collected in a buffer on the stack
+//
+size_t Print::PrintNumber( unsigned long ulValue, uint8_t usBase )
+{
+	char	arcBuffer[ 8 * sizeof( long ) + 1 ];
+	char	*pcDigit = &arcBuffer[ sizeof( arcBuffer ) - 1 ];
+
+	*pcDigit = '\0';
+
+	if( 2 > usBase )
+	{
+		usBase = 10;
+	}
+
+	do
+	{
+		char	cDigit = ulValue % usBase;
+
+		ulValue	/= usBase;
+		*--pcDigit = (cDigit < 10) ? (cDigit + '0') : (cDigit + 'A' - 10);
+	}
+	while( 0 != ulValue );
+
+	return( write( pcDigit ) );
+}
+
+//--------------------------------------------------------------------------
+//	like on AVR: sign, integer part, point and every decimal digit
+//	are written one after the other
+//
+size_t Print::PrintFloat( double dValue, uint8_t usDigits )
+{
+	size_t			uiWritten	= 0;
+	double			dRounding	= 0.5;
+	unsigned long	ulInteger;
+	double			dRemainder;
+
+	if( dValue != dValue )
+	{
+		return( print( "nan" ) );
+	}
+
+	if( 0.0 > dValue )
+	{
+		uiWritten	+= print( '-' );
+		dValue		 = -dValue;
+	}
+
+	for( uint8_t idx = 0 ; idx < usDigits ; idx++ )
+	{
+		dRounding /= 10.0;
+	}
+
+	dValue		+= dRounding;
+	ulInteger	 = (unsigned long)dValue;
+	dRemainder	 = dValue - (double)ulInteger;
+	uiWritten	+= print( ulInteger );
+
+	if( 0 < usDigits )
+	{
+		uiWritten += print( '.' );
+	}
+
+	while( 0 < usDigits-- )
+	{
+		unsigned int	uiDigit;
+
+		dRemainder	*= 10.0;
+		uiDigit		 = (unsigned int)dRemainder;
+		dRemainder	-= uiDigit;
+		uiWritten	+= print( uiDigit );
+	}
+
+	return( uiWritten );
+}
@@ -0,0 +1,112 @@
+//##########################################################################
+//#
+//#		host_demo.cpp	(host build)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Runs the library against the SH1106 model, prints the picture on the
+//#	simulated display and the traffic on the simulated bus. With trace
+//#	(SIMPLE_OLED_TRACE_SIZE > 0) the trace follows (see trace_decode.cpp).
+//#
+//#	usage:	host_demo [clock in Hz | auto [highest clock of the bus in Hz]]
+//#			auto	selects the clock with AutoTuneClock(), the simulated
+//#					bus works up to the given clock (default: no limit)
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SPI.h>
+
+#include "sh1106_model.h"
+#include "simple_oled_sh1106.h"
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+Sh1106Model		g_clPanel;
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	bool			bAuto	= (1 < argc) && (0 == strcmp( argv[ 1 ], "auto" ));
+	uint32_t		ulClock	= (1 < argc) ? strtoul( argv[ 1 ], NULL, 0 ) : WIRE_DEFAULT_CLOCK;
+	WireStatistic	tStatistic;
+
+	if( bAuto )
+	{
+		Wire.SetMaxClock( (2 < argc) ? strtoul( argv[ 2 ], NULL, 0 ) : 0 );
+	}
+
+	Wire.Attach( DISPLAY_ADDRESS, &g_clPanel );
+#if SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_SPI
+	SPI.Attach( &g_clPanel, SIMPLE_OLED_SPI_PIN_DC, SIMPLE_OLED_SPI_PIN_CS );
+#endif
+
+	if( 0 != g_clDisplay.Init() )
+	{
+		fprintf( stderr, "display not found\n" );
+		return( 1 );
+	}
+
+	if( bAuto )
+	{
+		ulClock = g_clDisplay.AutoTuneClock();
+	}
+	else
+	{
+#if SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_SPI
+		Wire.setClock( ulClock );
+#else
+		g_clDisplay.SetBusClock( ulClock );
+#endif
+	}
+
+	Wire.ResetStatistic();
+	SPI.ResetStatistic();
+
+	g_clDisplay.Print( F( "Host Demo" ) );
+	g_clDisplay.SetCursor( 2, 0 );
+	g_clDisplay.PrintLn( "Normal Text" );
+	g_clDisplay.SetInverseFont( true );
+	g_clDisplay.Print( "Inverse Font" );
+	g_clDisplay.SetInverseFont( false );
+	g_clDisplay.SetCursor( 5, 0 );
+	g_clDisplay.Print( "0123456789ABCDEFwrap" );
+
+	g_clPanel.Dump( stdout );
+
+#if SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_SPI
+	tStatistic = SPI.Statistic();
+#else
+	tStatistic = Wire.Statistic();
+#endif
+
+	printf( "clock:          %lu Hz\n",	(unsigned long)ulClock );
+	printf( "transactions:   %lu\n",	(unsigned long)tStatistic.ulTransactions );
+	printf( "payload bytes:  %lu\n",	(unsigned long)tStatistic.ulPayloadBytes );
+	printf( "overhead bits:  %lu\n",	(unsigned long)tStatistic.ulOverheadBits );
+	printf( "bus time:       %.1f us\n",	tStatistic.dBusMicros );
+	printf( "overflows:      %lu\n",	(unsigned long)tStatistic.ulOverflows );
+
+#if SIMPLE_OLED_TRACE_SIZE
+	g_clDisplay.DumpTrace( Serial );
+#endif
+
+	return( (0 == tStatistic.ulOverflows) ? 0 : 1 );
+}
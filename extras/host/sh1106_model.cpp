@@ -0,0 +1,388 @@
+//##########################################################################
+//#
+//#		sh1106_model.cpp	(host build)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Model of an OLED display with the sh1106 chipset.
+//#	(see sh1106_model.h)
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <string.h>
+
+#include "sh1106_model.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+//----	Control byte  ------------------------------------------------------
+#define CONTROL_CONTINUATION			0x80
+#define CONTROL_DATA					0x40
+
+//----	Commands with one parameter byte  ----------------------------------
+#define CMD_CONTRAST					0x81
+#define CMD_MULTIPLEX_RATIO				0xA8
+#define CMD_DC_DC						0xAD
+#define CMD_DISPLAY_OFFSET				0xD3
+#define CMD_CLOCK_DIVIDE				0xD5
+#define CMD_PRECHARGE					0xD9
+#define CMD_COM_PADS					0xDA
+#define CMD_VCOM_DESELECT				0xDB
+
+#define NO_PENDING_COMMAND				0x00
+
+
+////////////////////////////////////////////////////////////////////////////
+//
+//	CLASS: Sh1106Model
+//
+
+
+//**************************************************************************
+//	Constructor
+//--------------------------------------------------------------------------
+//
+Sh1106Model::Sh1106Model()
+{
+	Reset();
+}
+
+
+//**************************************************************************
+//	Reset
+//--------------------------------------------------------------------------
+//	Sets the model to the state after power on.
+//	The content of the display RAM is random after power on, this model
+//	fills it with a pattern, so that missing clear operations are visible.
+//
+void Sh1106Model::Reset( void )
+{
+	for( uint8_t usPage = 0 ; usPage < SH1106_PAGES ; usPage++ )
+	{
+		memset( m_arusRam[ usPage ], 0xA5, SH1106_COLUMNS );
+	}
+
+	m_usPage			= 0;
+	m_usColumn			= 0;
+	m_usStartLine		= 0;
+	m_usDisplayOffset	= 0;
+	m_usContrast		= 0x80;
+	m_usPendingCommand	= NO_PENDING_COMMAND;
+	m_bSegmentRemap		= false;
+	m_bScanReverse		= false;
+	m_bInverse			= false;
+	m_bEntireOn			= false;
+	m_bDisplayOn		= false;
+	m_bReadData			= false;
+	m_bReadModifyWrite	= false;
+	m_usModifyColumn	= 0;
+	m_usReadLatch		= 0;
+	m_ulCommandBytes	= 0;
+	m_ulDataBytes		= 0;
+	m_ulUnknownCommands	= 0;
+}
+
+
+//**************************************************************************
+//	Transaction
+//--------------------------------------------------------------------------
+//	Decodes the payload of one I²C write transmission (without the
+//	address byte).
+//
+void Sh1106Model::Transaction( const uint8_t *pusData, size_t uiLength )
+{
+	size_t	uiIdx = 0;
+
+	while( uiIdx < uiLength )
+	{
+		uint8_t	usControl = pusData[ uiIdx++ ];
+		bool	bData		= (0 != (usControl & CONTROL_DATA));
+
+		//------------------------------------------------------------------
+		//	a read after this transmission returns data or the status
+		//
+		m_bReadData = bData;
+
+		if( usControl & CONTROL_CONTINUATION )
+		{
+			//----------------------------------------------------------
+			//	just one byte follows, then the next control byte
+			//
+			if( uiIdx < uiLength )
+			{
+				if( bData )
+				{
+					Data( pusData[ uiIdx++ ] );
+				}
+				else
+				{
+					Command( pusData[ uiIdx++ ] );
+				}
+			}
+		}
+		else
+		{
+			//----------------------------------------------------------
+			//	all remaining bytes are of the same kind
+			//
+			while( uiIdx < uiLength )
+			{
+				if( bData )
+				{
+					Data( pusData[ uiIdx++ ] );
+				}
+				else
+				{
+					Command( pusData[ uiIdx++ ] );
+				}
+			}
+		}
+	}
+}
+
+
+//**************************************************************************
+//	SpiWrite
+//--------------------------------------------------------------------------
+//	Handles one byte that is received over the 4-wire SPI interface.
+//	There are no control bytes, the D/C pin tells if it is data or
+//	a command.
+//
+void Sh1106Model::SpiWrite( bool bData, uint8_t usByte )
+{
+	if( bData )
+	{
+		Data( usByte );
+	}
+	else
+	{
+		Command( usByte );
+	}
+}
+
+
+//**************************************************************************
+//	Status
+//--------------------------------------------------------------------------
+//	Returns the status byte that is read from the chip.
+//		bit 7:	BUSY
+//		bit 6:	ON/OFF	('1' = display off)
+//
+uint8_t Sh1106Model::Status( void )
+{
+	return( m_bDisplayOn ? 0x00 : 0x40 );
+}
+
+
+//**************************************************************************
+//	Read
+//--------------------------------------------------------------------------
+//	Returns the next byte of an I²C read. After a control byte for data
+//	the display RAM is read, otherwise the status byte.
+//	Like the chip the model returns the byte of the read before (the
+//	first read after a new address is a dummy read). The column is
+//	incremented, but not in read-modify-write mode.
+//
+uint8_t Sh1106Model::Read( void )
+{
+	uint8_t	usData = m_usReadLatch;
+
+	if( !m_bReadData )
+	{
+		return( Status() );
+	}
+
+	if( SH1106_COLUMNS > m_usColumn )
+	{
+		m_usReadLatch = m_arusRam[ m_usPage ][ m_usColumn ];
+
+		if( !m_bReadModifyWrite )
+		{
+			m_usColumn++;
+		}
+	}
+
+	return( usData );
+}
+
+
+//**************************************************************************
+//	Pixel
+//--------------------------------------------------------------------------
+//	Returns the state of the visible pixel at the given position of the
+//	panel (x: 0 - 131, y: 0 - 63).
+//
+bool Sh1106Model::Pixel( uint8_t usX, uint8_t usY )
+{
+	uint8_t	usRow;
+	uint8_t	usColumn;
+	bool	bOn;
+
+	if( !m_bDisplayOn )
+	{
+		return( false );
+	}
+
+	if( m_bEntireOn )
+	{
+		return( true );
+	}
+
+	usRow		= m_bScanReverse ? (SH1106_ROWS - 1 - usY) : usY;
+	usRow		= (usRow + m_usStartLine + m_usDisplayOffset) % SH1106_ROWS;
+	usColumn	= m_bSegmentRemap ? (SH1106_COLUMNS - 1 - usX) : usX;
+
+	bOn = (0 != (m_arusRam[ usRow >> 3 ][ usColumn ] & (1 << (usRow & 0x07))));
+
+	return( m_bInverse ? !bOn : bOn );
+}
+
+
+//**************************************************************************
+//	Dump
+//--------------------------------------------------------------------------
+//	Prints the visible picture as text, two rows of pixels per line.
+//
+void Sh1106Model::Dump( FILE *pFile )
+{
+	for( uint8_t usY = 0 ; usY < SH1106_ROWS ; usY += 2 )
+	{
+		for( uint8_t usX = 0 ; usX < SH1106_COLUMNS ; usX++ )
+		{
+			bool	bUpper = Pixel( usX, usY );
+			bool	bLower = Pixel( usX, usY + 1 );
+
+			fputc( bUpper ? (bLower ? '#' : '"') : (bLower ? '.' : ' '), pFile );
+		}
+
+		fputc( '\n', pFile );
+	}
+}
+
+
+//**************************************************************************
+//	Command (private)
+//--------------------------------------------------------------------------
+//
+void Sh1106Model::Command( uint8_t usCommand )
+{
+	m_ulCommandBytes++;
+
+	//----------------------------------------------------------------------
+	//	parameter of a two byte command
+	//
+	if( NO_PENDING_COMMAND != m_usPendingCommand )
+	{
+		switch( m_usPendingCommand )
+		{
+			case CMD_CONTRAST:
+				m_usContrast = usCommand;
+				break;
+
+			case CMD_DISPLAY_OFFSET:
+				m_usDisplayOffset = usCommand & 0x3F;
+				break;
+
+			default:
+				break;
+		}
+
+		m_usPendingCommand = NO_PENDING_COMMAND;
+		return;
+	}
+
+	if( 0x10 > usCommand )
+	{
+		m_usColumn = (m_usColumn & 0xF0) | (usCommand & 0x0F);
+	}
+	else if( 0x20 > usCommand )
+	{
+		m_usColumn = (m_usColumn & 0x0F) | ((usCommand & 0x0F) << 4);
+	}
+	else if( (0x40 <= usCommand) && (0x80 > usCommand) )
+	{
+		m_usStartLine = usCommand & 0x3F;
+	}
+	else if( (0xB0 <= usCommand) && (0xB8 > usCommand) )
+	{
+		m_usPage = usCommand & 0x07;
+	}
+	else
+	{
+		switch( usCommand )
+		{
+			case 0xA0:	m_bSegmentRemap	= false;	break;
+			case 0xA1:	m_bSegmentRemap	= true;		break;
+			case 0xA4:	m_bEntireOn		= false;	break;
+			case 0xA5:	m_bEntireOn		= true;		break;
+			case 0xA6:	m_bInverse		= false;	break;
+			case 0xA7:	m_bInverse		= true;		break;
+			case 0xAE:	m_bDisplayOn	= false;	break;
+			case 0xAF:	m_bDisplayOn	= true;		break;
+			case 0xC0:	m_bScanReverse	= false;	break;
+			case 0xC8:	m_bScanReverse	= true;		break;
+
+			case 0xE0:
+				m_bReadModifyWrite	= true;
+				m_usModifyColumn	= m_usColumn;
+				break;
+
+			case 0xEE:
+				if( m_bReadModifyWrite )
+				{
+					m_bReadModifyWrite	= false;
+					m_usColumn			= m_usModifyColumn;
+				}
+				break;
+
+			case 0x30:	case 0x31:	case 0x32:	case 0x33:	//	pump voltage
+			case 0xE3:										//	NOP
+				break;
+
+			case CMD_CONTRAST:
+			case CMD_MULTIPLEX_RATIO:
+			case CMD_DC_DC:
+			case CMD_DISPLAY_OFFSET:
+			case CMD_CLOCK_DIVIDE:
+			case CMD_PRECHARGE:
+			case CMD_COM_PADS:
+			case CMD_VCOM_DESELECT:
+				m_usPendingCommand = usCommand;
+				break;
+
+			default:
+				m_ulUnknownCommands++;
+				break;
+		}
+	}
+}
+
+
+//**************************************************************************
+//	Data (private)
+//--------------------------------------------------------------------------
+//	Writes one byte into the display RAM and increments the column.
+//	The column address stops at the last column of the page.
+//
+void Sh1106Model::Data( uint8_t usData )
+{
+	m_ulDataBytes++;
+
+	if( SH1106_COLUMNS > m_usColumn )
+	{
+		m_arusRam[ m_usPage ][ m_usColumn ] = usData;
+		m_usColumn++;
+	}
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		sh1106_model.h	(host build)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Model of an OLED display with the sh1106 chipset.
+//#	The model decodes the byte stream of an I²C transmission the same
+//#	way the chip does:
+//#		-	control bytes 0x80 / 0x00 (command) and 0xC0 / 0x40 (data)
+//#		-	page and column addressing with auto increment of the column
+//#		-	display start line and display offset (0xD3)
+//#		-	segment remap and output scan direction
+//#		-	normal / inverse display and entire display on
+//#		-	read of the status or of the display RAM (with the dummy
+//#			read after a new address) and read-modify-write (0xE0 / 0xEE)
+//#	and writes the display data into a 132 x 64 framebuffer.
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define SH1106_COLUMNS					132
+#define SH1106_PAGES					8
+#define SH1106_ROWS						64
+
+
+//==========================================================================
+//
+//		C L A S S   D E F I N I T I O N S
+//
+//==========================================================================
+
+
+////////////////////////////////////////////////////////////////////////////
+//	CLASS: Sh1106Model
+//
+class Sh1106Model
+{
+	public:
+		Sh1106Model();
+
+		void Reset( void );
+		void Transaction( const uint8_t *pusData, size_t uiLength );
+		void SpiWrite( bool bData, uint8_t usByte );
+		uint8_t Status( void );
+		uint8_t Read( void );
+
+		//----	visible picture (after offset, remap, scan and inverse)  ---
+		bool Pixel( uint8_t usX, uint8_t usY );
+		void Dump( FILE *pFile );
+
+		//----	content of the display RAM  --------------------------------
+		uint8_t RamByte( uint8_t usPage, uint8_t usColumn )
+		{
+			return( m_arusRam[ usPage ][ usColumn ] );
+		};
+
+		uint8_t Page( void )			{ return( m_usPage ); };
+		uint8_t Column( void )			{ return( m_usColumn ); };
+		uint8_t StartLine( void )		{ return( m_usStartLine ); };
+		uint8_t DisplayOffset( void )	{ return( m_usDisplayOffset ); };
+		bool	SegmentRemap( void )	{ return( m_bSegmentRemap ); };
+		bool	ScanReverse( void )		{ return( m_bScanReverse ); };
+		bool	Inverse( void )			{ return( m_bInverse ); };
+		bool	EntireOn( void )		{ return( m_bEntireOn ); };
+		bool	DisplayOn( void )		{ return( m_bDisplayOn ); };
+
+		uint32_t	CommandBytes( void )	{ return( m_ulCommandBytes ); };
+		uint32_t	DataBytes( void )		{ return( m_ulDataBytes ); };
+		uint32_t	UnknownCommands( void )	{ return( m_ulUnknownCommands ); };
+
+	private:
+		uint8_t		m_arusRam[ SH1106_PAGES ][ SH1106_COLUMNS ];
+		uint8_t		m_usPage;
+		uint8_t		m_usColumn;
+		uint8_t		m_usStartLine;
+		uint8_t		m_usDisplayOffset;
+		uint8_t		m_usContrast;
+		uint8_t		m_usPendingCommand;
+		bool		m_bSegmentRemap;
+		bool		m_bScanReverse;
+		bool		m_bInverse;
+		bool		m_bEntireOn;
+		bool		m_bDisplayOn;
+		bool		m_bReadData;
+		bool		m_bReadModifyWrite;
+		uint8_t		m_usModifyColumn;
+		uint8_t		m_usReadLatch;
+		uint32_t	m_ulCommandBytes;
+		uint32_t	m_ulDataBytes;
+		uint32_t	m_ulUnknownCommands;
+
+		void Command( uint8_t usCommand );
+		void Data( uint8_t usData );
+};
@@ -0,0 +1,582 @@
+//##########################################################################
+//#
+//#		trace_decode.cpp	(host build)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Decodes the output of DumpTrace() (see simple_oled_sh1106.h), e.g. a
+//#	log of the serial monitor, and prints for every dump:
+//#		-	the timeline of the records, the calls of the public functions
+//#			are indented by their nesting
+//#		-	for every group of public functions (SIMPLE_OLED_API_xxx) the
+//#			number, the shortest, average and longest duration of the
+//#			outermost calls and a histogram of the durations
+//#		-	the same for the transmissions
+//#		-	the longest call with the time on the bus and the time outside
+//#			of the transmissions
+//#		-	the number of repeated transmissions and how often the display
+//#			went offline and was recovered (see SetRecovery())
+//#
+//#	Lines outside of a dump are ignored. The first record of a dump is
+//#	the time 0, calls and transmissions whose start was overwritten in
+//#	the ring are not counted.
+//#
+//#	usage:	trace_decode [-s] < log
+//#			-s	only the summary, no timeline
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "simple_oled_sh1106.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define LINE_LENGTH						128
+#define MAX_NESTING						16
+
+//----	Histogram  ---------------------------------------------------------
+//	bucket 0 holds durations below 64 µs, each further bucket doubles the
+//	limit, the last bucket holds all longer durations
+//
+#define HISTOGRAM_BUCKETS				14
+#define HISTOGRAM_FIRST_LIMIT			64
+#define HISTOGRAM_BAR_WIDTH				40
+
+#define TX_GROUP						SIMPLE_OLED_API_COUNT
+#define GROUPS							(SIMPLE_OLED_API_COUNT + 1)
+
+typedef struct
+{
+	uint32_t	ulCount;
+	uint64_t	ullSumMicros;
+	uint64_t	ullMinMicros;
+	uint64_t	ullMaxMicros;
+	uint32_t	arulBuckets[ HISTOGRAM_BUCKETS ];
+} Durations;
+
+typedef struct
+{
+	uint8_t		usApi;
+	uint64_t	ullStart;
+} OpenCall;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+static const char * const	g_arpstrGroupName[ GROUPS ] =
+{
+	"INIT", "PRINT", "FIELD", "CLEAR", "CURSOR",
+	"GRAPHICS", "DISPLAY", "FLUSH", "UPDATE", "transmissions"
+};
+
+bool		g_bTimeline	= true;
+
+Durations	g_artDurations[ GROUPS ];
+OpenCall	g_artOpen[ MAX_NESTING ];
+uint8_t		g_usDepth;
+
+uint64_t	g_ullTxStart;
+bool		g_bTxOpen;
+uint32_t	g_ulTxErrors;
+uint64_t	g_ullTxBytes;
+uint32_t	g_ulRetries;
+uint32_t	g_ulOffline;
+uint32_t	g_ulRecoveries;
+
+//----	bus activity within the actual outermost call and the longest call  --
+uint64_t	g_ullCallBusMicros;
+uint32_t	g_ulCallTransmissions;
+uint8_t		g_usLongestApi;
+uint64_t	g_ullLongestStart;
+uint64_t	g_ullLongestMicros;
+uint64_t	g_ullLongestBusMicros;
+uint32_t	g_ulLongestTransmissions;
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+//**************************************************************************
+//	GroupName
+//--------------------------------------------------------------------------
+//
+static const char * GroupName( uint8_t usGroup )
+{
+	return( (GROUPS > usGroup) ? g_arpstrGroupName[ usGroup ] : "?" );
+}
+
+
+//**************************************************************************
+//	AddDuration
+//--------------------------------------------------------------------------
+//	The function adds a duration to the statistic of a group.
+//
+static void AddDuration( uint8_t usGroup, uint64_t ullMicros )
+{
+	Durations *	ptDurations;
+	uint64_t	ullLimit	= HISTOGRAM_FIRST_LIMIT;
+	uint8_t		usBucket	= 0;
+
+	if( GROUPS <= usGroup )
+	{
+		return;
+	}
+
+	ptDurations = &g_artDurations[ usGroup ];
+
+	if( (0 == ptDurations->ulCount) || (ptDurations->ullMinMicros > ullMicros) )
+	{
+		ptDurations->ullMinMicros = ullMicros;
+	}
+
+	if( ptDurations->ullMaxMicros < ullMicros )
+	{
+		ptDurations->ullMaxMicros = ullMicros;
+	}
+
+	ptDurations->ulCount++;
+	ptDurations->ullSumMicros += ullMicros;
+
+	while( (ullMicros >= ullLimit) && ((HISTOGRAM_BUCKETS - 1) > usBucket) )
+	{
+		ullLimit <<= 1;
+		usBucket++;
+	}
+
+	ptDurations->arulBuckets[ usBucket ]++;
+}
+
+
+//**************************************************************************
+//	PrintDurations
+//--------------------------------------------------------------------------
+//	The function prints the statistic and the histogram of a group.
+//
+static void PrintDurations( uint8_t usGroup )
+{
+	Durations *	ptDurations	= &g_artDurations[ usGroup ];
+	uint32_t	ulMaxCount	= 0;
+	uint64_t	ullLimit	= HISTOGRAM_FIRST_LIMIT;
+	uint8_t		usFirst		= HISTOGRAM_BUCKETS;
+	uint8_t		usLast		= 0;
+	uint8_t		usBucket;
+
+	if( 0 == ptDurations->ulCount )
+	{
+		return;
+	}
+
+	printf( "\n%-14s %6lu   min %8llu us   avg %8llu us   max %8llu us\n",
+			GroupName( usGroup ), (unsigned long)ptDurations->ulCount,
+			(unsigned long long)ptDurations->ullMinMicros,
+			(unsigned long long)(ptDurations->ullSumMicros / ptDurations->ulCount),
+			(unsigned long long)ptDurations->ullMaxMicros );
+
+	for( usBucket = 0 ; usBucket < HISTOGRAM_BUCKETS ; usBucket++ )
+	{
+		if( 0 < ptDurations->arulBuckets[ usBucket ] )
+		{
+			if( HISTOGRAM_BUCKETS == usFirst )
+			{
+				usFirst = usBucket;
+			}
+
+			usLast = usBucket;
+
+			if( ulMaxCount < ptDurations->arulBuckets[ usBucket ] )
+			{
+				ulMaxCount = ptDurations->arulBuckets[ usBucket ];
+			}
+		}
+	}
+
+	for( usBucket = 0 ; usBucket <= usLast ; usBucket++ )
+	{
+		if( usBucket >= usFirst )
+		{
+			uint32_t	ulCount	= ptDurations->arulBuckets[ usBucket ];
+			uint32_t	ulBar	= (uint32_t)(((uint64_t)ulCount * HISTOGRAM_BAR_WIDTH + ulMaxCount - 1) / ulMaxCount);
+
+			if( (HISTOGRAM_BUCKETS - 1) == usBucket )
+			{
+				printf( "  >= %7llu us %6lu  ", (unsigned long long)(ullLimit >> 1), (unsigned long)ulCount );
+			}
+			else
+			{
+				printf( "  <  %7llu us %6lu  ", (unsigned long long)ullLimit, (unsigned long)ulCount );
+			}
+
+			while( 0 < ulBar-- )
+			{
+				putchar( '#' );
+			}
+
+			putchar( '\n' );
+		}
+
+		ullLimit <<= 1;
+	}
+}
+
+
+//**************************************************************************
+//	StartDump
+//--------------------------------------------------------------------------
+//	The function clears the statistic for the next dump.
+//
+static void StartDump( unsigned long ulRecords )
+{
+	memset( g_artDurations, 0, sizeof( g_artDurations ) );
+
+	g_usDepth					= 0;
+	g_bTxOpen					= false;
+	g_ulTxErrors				= 0;
+	g_ullTxBytes				= 0;
+	g_ulRetries					= 0;
+	g_ulOffline					= 0;
+	g_ulRecoveries				= 0;
+	g_ullCallBusMicros			= 0;
+	g_ulCallTransmissions		= 0;
+	g_ullLongestMicros			= 0;
+	g_ullLongestBusMicros		= 0;
+	g_ulLongestTransmissions	= 0;
+
+	printf( "trace with %lu records\n", ulRecords );
+
+	if( g_bTimeline )
+	{
+		printf( "\n%12s %9s  %s\n", "time_us", "delta_us", "event" );
+	}
+}
+
+
+//**************************************************************************
+//	DecodeRecord
+//--------------------------------------------------------------------------
+//	The function decodes one record at the time ullTime (µs since the
+//	first record of the dump).
+//
+static void DecodeRecord( uint64_t ullTime, uint8_t usEvent, uint8_t usValue, uint16_t uiDelta )
+{
+	uint64_t	ullMicros;
+	uint8_t		usIndent = g_usDepth;
+
+	if( SIMPLE_OLED_TRACE_API_END == usEvent )
+	{
+		usIndent = (0 < g_usDepth) ? (g_usDepth - 1) : 0;
+	}
+
+	if( g_bTimeline )
+	{
+		printf( "%12llu %9u  %*s", (unsigned long long)ullTime, uiDelta, 2 * usIndent, "" );
+	}
+
+	switch( usEvent )
+	{
+		case SIMPLE_OLED_TRACE_API_BEGIN:
+			if( MAX_NESTING > g_usDepth )
+			{
+				if( 0 == g_usDepth )
+				{
+					g_ullCallBusMicros		= 0;
+					g_ulCallTransmissions	= 0;
+				}
+
+				g_artOpen[ g_usDepth ].usApi	= usValue;
+				g_artOpen[ g_usDepth ].ullStart	= ullTime;
+				g_usDepth++;
+			}
+
+			if( g_bTimeline )
+			{
+				printf( "> %s\n", GroupName( usValue ) );
+			}
+			break;
+
+		case SIMPLE_OLED_TRACE_API_END:
+			if( 0 == g_usDepth )
+			{
+				//----------------------------------------------------------
+				//	the start of the call was overwritten in the ring
+				//
+				if( g_bTimeline )
+				{
+					printf( "< %s\n", GroupName( usValue ) );
+				}
+				break;
+			}
+
+			g_usDepth--;
+			ullMicros = ullTime - g_artOpen[ g_usDepth ].ullStart;
+
+			if( g_bTimeline )
+			{
+				printf( "< %s  %llu us\n", GroupName( usValue ), (unsigned long long)ullMicros );
+			}
+
+			if( 0 == g_usDepth )
+			{
+				AddDuration( usValue, ullMicros );
+
+				if( g_ullLongestMicros < ullMicros )
+				{
+					g_usLongestApi				= usValue;
+					g_ullLongestStart			= g_artOpen[ 0 ].ullStart;
+					g_ullLongestMicros			= ullMicros;
+					g_ullLongestBusMicros		= g_ullCallBusMicros;
+					g_ulLongestTransmissions	= g_ulCallTransmissions;
+				}
+			}
+			break;
+
+		case SIMPLE_OLED_TRACE_TX_BEGIN:
+			g_ullTxStart	= ullTime;
+			g_bTxOpen		= true;
+
+			if( g_bTimeline )
+			{
+				printf( "tx begin\n" );
+			}
+			break;
+
+		case SIMPLE_OLED_TRACE_TX_END:
+			if( !g_bTxOpen )
+			{
+				if( g_bTimeline )
+				{
+					printf( "tx end  %u bytes\n", usValue );
+				}
+				break;
+			}
+
+			g_bTxOpen	= false;
+			ullMicros	= ullTime - g_ullTxStart;
+
+			if( g_bTimeline )
+			{
+				printf( "tx end  %u bytes  %llu us\n", usValue, (unsigned long long)ullMicros );
+			}
+
+			AddDuration( TX_GROUP, ullMicros );
+			g_ullTxBytes += usValue;
+
+			if( 0 < g_usDepth )
+			{
+				g_ullCallBusMicros += ullMicros;
+				g_ulCallTransmissions++;
+			}
+			break;
+
+		case SIMPLE_OLED_TRACE_TX_ERROR:
+			g_ulTxErrors++;
+
+			if( g_bTimeline )
+			{
+				printf( "tx error %u\n", usValue );
+			}
+			break;
+
+		case SIMPLE_OLED_TRACE_GAP:
+			if( g_bTimeline )
+			{
+				printf( "gap %u ms\n", uiDelta );
+			}
+			break;
+
+		case SIMPLE_OLED_TRACE_RETRY:
+			//--------------------------------------------------------------
+			//	the repetition starts after the pause, it is counted as a
+			//	transmission of its own
+			//
+			g_ullTxStart	= ullTime;
+			g_bTxOpen		= true;
+			g_ulRetries++;
+
+			if( g_bTimeline )
+			{
+				printf( "tx retry %u\n", usValue );
+			}
+			break;
+
+		case SIMPLE_OLED_TRACE_OFFLINE:
+			g_ulOffline++;
+
+			if( g_bTimeline )
+			{
+				printf( "offline, error %u\n", usValue );
+			}
+			break;
+
+		case SIMPLE_OLED_TRACE_RECOVER:
+			g_ulRecoveries++;
+
+			if( g_bTimeline )
+			{
+				printf( "recover, %s\n", (SIMPLE_OLED_RECOVER_RESET == usValue) ? "display was reset" : "display found" );
+			}
+			break;
+
+		default:
+			if( g_bTimeline )
+			{
+				printf( "unknown event %u, value %u\n", usEvent, usValue );
+			}
+			break;
+	}
+}
+
+
+//**************************************************************************
+//	EndDump
+//--------------------------------------------------------------------------
+//	The function prints the summary of a dump.
+//
+static void EndDump( void )
+{
+	uint8_t	usGroup;
+
+	for( usGroup = 0 ; usGroup < GROUPS ; usGroup++ )
+	{
+		PrintDurations( usGroup );
+	}
+
+	printf( "\ntransmitted bytes: %llu, errors: %lu\n",
+			(unsigned long long)g_ullTxBytes, (unsigned long)g_ulTxErrors );
+
+	if( (0 < g_ulRetries) || (0 < g_ulOffline) || (0 < g_ulRecoveries) )
+	{
+		printf( "retries: %lu, offline: %lu, recoveries: %lu\n",
+				(unsigned long)g_ulRetries, (unsigned long)g_ulOffline, (unsigned long)g_ulRecoveries );
+	}
+
+	if( 0 < g_ullLongestMicros )
+	{
+		printf( "longest call: %s at %llu us, %llu us, %lu transmissions with %llu us, %llu us outside of the transmissions\n",
+				GroupName( g_usLongestApi ),
+				(unsigned long long)g_ullLongestStart,
+				(unsigned long long)g_ullLongestMicros,
+				(unsigned long)g_ulLongestTransmissions,
+				(unsigned long long)g_ullLongestBusMicros,
+				(unsigned long long)(g_ullLongestMicros - g_ullLongestBusMicros) );
+	}
+
+	printf( "\n" );
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	char			acLine[ LINE_LENGTH ];
+	bool			bInDump		= false;
+	bool			bFirst		= false;
+	uint64_t		ullTime		= 0;
+	uint64_t		ullGap		= 0;
+	unsigned long	ulRecords;
+	unsigned long	ulRecord;
+	char *			pcEnd;
+
+	if( (1 < argc) && (0 == strcmp( argv[ 1 ], "-s" )) )
+	{
+		g_bTimeline = false;
+	}
+
+	while( NULL != fgets( acLine, sizeof( acLine ), stdin ) )
+	{
+		acLine[ strcspn( acLine, "\r\n" ) ] = '\0';
+
+		if( 0 == strcmp( acLine, "SIMPLE_OLED_TRACE_END" ) )
+		{
+			if( bInDump )
+			{
+				EndDump();
+			}
+
+			bInDump = false;
+			continue;
+		}
+
+		if( 1 == sscanf( acLine, "SIMPLE_OLED_TRACE %lu", &ulRecords ) )
+		{
+			StartDump( ulRecords );
+
+			bInDump	= true;
+			bFirst	= true;
+			ullTime	= 0;
+			ullGap	= 0;
+			continue;
+		}
+
+		if( !bInDump )
+		{
+			continue;
+		}
+
+		ulRecord = strtoul( acLine, &pcEnd, 16 );
+
+		if( (8 != (pcEnd - acLine)) || ('\0' != *pcEnd) )
+		{
+			fprintf( stderr, "invalid record: %s\n", acLine );
+			continue;
+		}
+
+		uint8_t		usEvent	= (uint8_t)(ulRecord >> 24);
+		uint8_t		usValue	= (uint8_t)(ulRecord >> 16);
+		uint16_t	uiDelta	= (uint16_t)ulRecord;
+
+		//------------------------------------------------------------------
+		//	a gap holds the full milliseconds of the time until the next
+		//	record, the time of the first record is 0
+		//
+		if( SIMPLE_OLED_TRACE_GAP == usEvent )
+		{
+			ullGap = (uint64_t)uiDelta * 1000;
+		}
+		else
+		{
+			if( !bFirst )
+			{
+				ullTime += ullGap + uiDelta;
+			}
+
+			ullGap	= 0;
+			bFirst	= false;
+		}
+
+		DecodeRecord( ullTime, usEvent, usValue, uiDelta );
+	}
+
+	if( bInDump )
+	{
+		fprintf( stderr, "dump without end\n" );
+		EndDump();
+	}
+
+	return( 0 );
+}
@@ -0,0 +1,269 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		simple_oled_config.h
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Compile time options of the simple_oled_sh1106 library.
+//#	Change the values in this file or define them before the library
+//#	is compiled (e.g. with the compiler option -D).
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	In dieser Datei werden die Optionen der simple_oled_sh1106 Library
+//#	eingestellt, die beim Übersetzen festgelegt werden.
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+//--------------------------------------------------------------------------
+//	SIMPLE_OLED_TEXT_SHADOW
+//
+//	1:	the library keeps a copy of the characters shown on the display
+//		(128 bytes RAM). A character will only be transmitted to the
+//		display if it is different from the character that is already
+//		shown at that position.
+//	0:	every character will be transmitted to the display.
+//
+#ifndef SIMPLE_OLED_TEXT_SHADOW
+#define SIMPLE_OLED_TEXT_SHADOW			1
+#endif
+
+//--------------------------------------------------------------------------
+//	SIMPLE_OLED_FRAMEBUFFER
+//
+//	1:	the library keeps a copy of all pixels of the display
+//		(132 x 64 pixels = 1056 bytes RAM, e.g. for SAMD, nRF52, RP2040).
+//		All output goes into this framebuffer first. Flush() transmits
+//		only the changed columns of each page to the display.
+//	0:	every output is transmitted immediately (default).
+//
+#ifndef SIMPLE_OLED_FRAMEBUFFER
+#define SIMPLE_OLED_FRAMEBUFFER			0
+#endif
+
+//--------------------------------------------------------------------------
+//	SIMPLE_OLED_WIRE_BUFFER_SIZE
+//
+//	Size of the transmit buffer of the Wire library in bytes.
+//	0:	the size is selected according to the platform (default)
+//		(AVR, SAM: 32, nRF52: 64, megaAVR: 128, SAMD, mbed, RP2040: 256)
+//	n:	transmissions to the display will have not more than n bytes
+//
+#ifndef SIMPLE_OLED_WIRE_BUFFER_SIZE
+#define SIMPLE_OLED_WIRE_BUFFER_SIZE	0
+#endif
+
+//--------------------------------------------------------------------------
+//	SIMPLE_OLED_BLANK_ON_CLEAR
+//
+//	1:	the display is switched off while Clear() clears the display RAM,
+//		so the clearing of the display is not visible
+//	0:	the display stays on while it is cleared (default)
+//
+#ifndef SIMPLE_OLED_BLANK_ON_CLEAR
+#define SIMPLE_OLED_BLANK_ON_CLEAR		0
+#endif
+
+//--------------------------------------------------------------------------
+//	SIMPLE_OLED_TX_QUEUE_SIZE
+//
+//	0:	no transmit queue, every function waits until its transmissions
+//		are sent to the display (default)
+//	n:	size of the transmit queue in bytes (must be larger than the
+//		transmit buffer of the Wire library, e.g. 256).
+//		After SetAsync( true ) all functions put their transmissions into
+//		the queue and return at once. Update() sends the queued
+//		transmissions to the display.
+//
+#ifndef SIMPLE_OLED_TX_QUEUE_SIZE
+#define SIMPLE_OLED_TX_QUEUE_SIZE		0
+#endif
+
+//--------------------------------------------------------------------------
+//	SIMPLE_OLED_STATS
+//
+//	1:	the library counts transmissions, bytes, errors and the time spent
+//		on the bus and keeps the longest call of the public functions
+//		(see GetStats() and ResetStats())
+//	0:	no statistics, GetStats() returns zeros (default)
+//
+#ifndef SIMPLE_OLED_STATS
+#define SIMPLE_OLED_STATS				0
+#endif
+
+//--------------------------------------------------------------------------
+//	SIMPLE_OLED_TRACE_SIZE
+//
+//	number of records of the trace (4 bytes each): the library records
+//	the calls of the public functions and the transmissions with their
+//	bytes and the time since the previous record (see DumpTrace()),
+//	when the trace is full the oldest records are overwritten
+//	0:	no trace (default)
+//
+#ifndef SIMPLE_OLED_TRACE_SIZE
+#define SIMPLE_OLED_TRACE_SIZE			0
+#endif
+
+//--------------------------------------------------------------------------
+//	SIMPLE_OLED_RECOVERY
+//
+//	1:	a failed transmission is repeated, if it still fails the bus is
+//		cleared and the display is offline: the output only changes the
+//		text shadow or framebuffer until Update() finds the display again,
+//		initializes it and transmits the content again. Update() also
+//		reads the status of the display and does the same if the display
+//		was reset, e.g. by a brown-out (see SetRecovery() and IsOnline())
+//	0:	errors of the transmissions are ignored (default)
+//
+#ifndef SIMPLE_OLED_RECOVERY
+#define SIMPLE_OLED_RECOVERY			0
+#endif
+
+//----	default number of repetitions of a failed transmission  ------------
+#ifndef SIMPLE_OLED_RETRIES
+#define SIMPLE_OLED_RETRIES				2
+#endif
+
+//----	pause before the first repetition, doubles with each repetition  ---
+#ifndef SIMPLE_OLED_RETRY_MICROS
+#define SIMPLE_OLED_RETRY_MICROS		200
+#endif
+
+//----	default limit for the repetitions of one function call  ------------
+//	no repetition starts after this time, so a function call returns at
+//	the latest after this time plus one transmission and the bus timeout
+//
+#ifndef SIMPLE_OLED_MAX_BLOCK_MILLIS
+#define SIMPLE_OLED_MAX_BLOCK_MILLIS	10
+#endif
+
+//----	interval of Update() to read the status of the display  ------------
+//	0:	no check, a reset of the display is not detected
+//
+#ifndef SIMPLE_OLED_CHECK_MILLIS
+#define SIMPLE_OLED_CHECK_MILLIS		1000
+#endif
+
+//----	interval of Update() to look for an offline display  ---------------
+#ifndef SIMPLE_OLED_RECOVER_MILLIS
+#define SIMPLE_OLED_RECOVER_MILLIS		500
+#endif
+
+//--------------------------------------------------------------------------
+//	SIMPLE_OLED_MAX_DISPLAYS
+//
+//	maximum number of displays that can be added to a
+//	SimpleDisplayManager (see simple_oled_manager.h)
+//
+#ifndef SIMPLE_OLED_MAX_DISPLAYS
+#define SIMPLE_OLED_MAX_DISPLAYS		4
+#endif
+
+//--------------------------------------------------------------------------
+//	SIMPLE_OLED_FONT
+//
+//	Font of the text (see simple_oled_font.h and font.h):
+//	SIMPLE_OLED_FONT_8X8:	8 x 8 pixels, 16 columns x 8 lines (default)
+//	SIMPLE_OLED_FONT_6X8:	6 x 8 pixels, 21 columns x 8 lines
+//	SIMPLE_OLED_FONT_8X16:	8 x 16 pixels (8 x 8 glyphs doubled in height),
+//							16 columns x 4 lines
+//
+#define SIMPLE_OLED_FONT_8X8			1
+#define SIMPLE_OLED_FONT_6X8			2
+#define SIMPLE_OLED_FONT_8X16			3
+
+#ifndef SIMPLE_OLED_FONT
+#define SIMPLE_OLED_FONT				SIMPLE_OLED_FONT_8X8
+#endif
+
+//--------------------------------------------------------------------------
+//	SIMPLE_OLED_FONT_SCALE
+//
+//	1:	the glyphs are shown as they are (default)
+//	2:	every pixel of a glyph is shown as 2 x 2 pixels,
+//		e.g. 8 columns x 4 lines with the 8 x 8 font
+//	3:	every pixel of a glyph is shown as 3 x 3 pixels,
+//		e.g. 5 columns x 2 lines with the 8 x 8 font
+//
+#ifndef SIMPLE_OLED_FONT_SCALE
+#define SIMPLE_OLED_FONT_SCALE			1
+#endif
+
+//--------------------------------------------------------------------------
+//	SIMPLE_OLED_TRANSPORT
+//
+//	Interface to the display (see simple_oled_transport.h):
+//	SIMPLE_OLED_TRANSPORT_WIRE:		hardware I²C bus with the Wire library
+//									(default)
+//	SIMPLE_OLED_TRANSPORT_SPI:		4-wire SPI with the SPI library
+//	SIMPLE_OLED_TRANSPORT_SOFT_I2C:	I²C bus on any two pins (bit-banged)
+//
+#define SIMPLE_OLED_TRANSPORT_WIRE		1
+#define SIMPLE_OLED_TRANSPORT_SPI		2
+#define SIMPLE_OLED_TRANSPORT_SOFT_I2C	3
+
+#ifndef SIMPLE_OLED_TRANSPORT
+#define SIMPLE_OLED_TRANSPORT			SIMPLE_OLED_TRANSPORT_WIRE
+#endif
+
+//----	default pins and clock for SPI  ------------------------------------
+//	can be changed with g_clDisplay.Transport().SetPins() and SetClock()
+//
+#ifndef SIMPLE_OLED_SPI_PIN_DC
+#define SIMPLE_OLED_SPI_PIN_DC			9
+#endif
+
+#ifndef SIMPLE_OLED_SPI_PIN_CS
+#define SIMPLE_OLED_SPI_PIN_CS			10
+#endif
+
+#ifndef SIMPLE_OLED_SPI_PIN_RESET
+#define SIMPLE_OLED_SPI_PIN_RESET		8
+#endif
+
+#ifndef SIMPLE_OLED_SPI_CLOCK
+#define SIMPLE_OLED_SPI_CLOCK			4000000UL
+#endif
+
+//----	default pins and clock for software I²C  ---------------------------
+//	can be changed with g_clDisplay.Transport().SetPins() and SetClock()
+//
+#ifndef SIMPLE_OLED_SOFT_I2C_PIN_SDA
+#define SIMPLE_OLED_SOFT_I2C_PIN_SDA	2
+#endif
+
+#ifndef SIMPLE_OLED_SOFT_I2C_PIN_SCL
+#define SIMPLE_OLED_SOFT_I2C_PIN_SCL	3
+#endif
+
+#ifndef SIMPLE_OLED_SOFT_I2C_CLOCK
+#define SIMPLE_OLED_SOFT_I2C_CLOCK		100000UL
+#endif
+
+//----	clock of the hardware I²C bus in Hz  ------------------------------
+//	the sh1106 supports 400 kHz (fast mode), can be changed with
+//	g_clDisplay.SetBusClock() or found with g_clDisplay.AutoTuneClock()
+//	0:	the clock of the Wire library is not changed (default, 100 kHz)
+//
+#ifndef SIMPLE_OLED_WIRE_CLOCK
+#define SIMPLE_OLED_WIRE_CLOCK			0
+#endif
+
+//----	timeout of the I²C bus in µs  --------------------------------------
+//	a transmission waits at most this time for the bus, e.g. if a slave
+//	holds SCL low, can be changed with g_clDisplay.Transport().SetTimeout()
+//	0:	default of the Wire library, CLOCK_STRETCH_MAX half periods of
+//		the clock for software I²C (default)
+//
+#ifndef SIMPLE_OLED_BUS_TIMEOUT_MICROS
+#define SIMPLE_OLED_BUS_TIMEOUT_MICROS	0
+#endif
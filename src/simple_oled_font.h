@@ -0,0 +1,97 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		simple_oled_font.h
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Metrics of the font that is selected in simple_oled_config.h
+//#	(SIMPLE_OLED_FONT and SIMPLE_OLED_FONT_SCALE).
+//#	The bitmaps of the fonts are in the file font.h.
+//#
+//#	All fonts store the glyphs column by column, one byte holds 8 pixels
+//#	of one column of a page (bit 0 is the top pixel), exactly as the
+//#	bytes are sent to the display. All glyph tables are one page high,
+//#	the 8x16 font uses the glyphs of the 8x8 font doubled in height.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Maße des Zeichensatzes, der in simple_oled_config.h ausgewählt wird.
+//#	Die Bitmaps der Zeichensätze stehen in der Datei font.h.
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+
+#include "simple_oled_config.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#if (1 > SIMPLE_OLED_FONT_SCALE) || (3 < SIMPLE_OLED_FONT_SCALE)
+#error "SIMPLE_OLED_FONT_SCALE must be 1, 2 or 3"
+#endif
+
+//----	vertical scale of the glyphs  --------------------------------------
+//	the 8x16 font is the 8x8 font with every row doubled, this is done
+//	by the same lookup table as the scaling, so it needs no extra flash
+//
+#if SIMPLE_OLED_FONT == SIMPLE_OLED_FONT_8X16
+#define SIMPLE_OLED_FONT_HEIGHT_SCALE	(2 * SIMPLE_OLED_FONT_SCALE)
+#else
+#define SIMPLE_OLED_FONT_HEIGHT_SCALE	SIMPLE_OLED_FONT_SCALE
+#endif
+
+//----	pages of a glyph and of a character cell on the display  ----------
+//	also as preprocessor values, to leave out code for multi-page cells
+//
+#define SIMPLE_OLED_FONT_PAGES			1
+#define SIMPLE_OLED_CELL_PAGES			(SIMPLE_OLED_FONT_PAGES * SIMPLE_OLED_FONT_HEIGHT_SCALE)
+
+//--------------------------------------------------------------------------
+//	metrics of a font
+//
+typedef struct
+{
+	uint8_t		usWidth;		//	columns of a glyph
+	uint8_t		usPages;		//	pages of a glyph (8 pixels each)
+	uint8_t		usFirstChar;	//	character of the first glyph
+	uint8_t		usLastChar;		//	character of the last glyph
+} SimpleOledFontMetrics;
+
+
+//==========================================================================
+//
+//		C O N S T A N T S
+//
+//==========================================================================
+
+#if SIMPLE_OLED_FONT == SIMPLE_OLED_FONT_6X8
+constexpr SimpleOledFontMetrics	gc_tFont		= { 6, SIMPLE_OLED_FONT_PAGES, ' ', 127 };
+#else
+constexpr SimpleOledFontMetrics	gc_tFont		= { 8, SIMPLE_OLED_FONT_PAGES, ' ', 127 };
+#endif
+
+//----	bytes of one glyph in the font  ------------------------------------
+constexpr uint8_t	gc_usGlyphBytes		= gc_tFont.usWidth * gc_tFont.usPages;
+
+//----	size of one character cell on the display  ------------------------
+//	the glyph is scaled by SIMPLE_OLED_FONT_SCALE in both directions,
+//	the 8x16 font is scaled twice as much in height
+//
+constexpr uint8_t	gc_usFontScale		= SIMPLE_OLED_FONT_SCALE;
+constexpr uint8_t	gc_usFontHeightScale	= SIMPLE_OLED_FONT_HEIGHT_SCALE;
+constexpr uint8_t	gc_usCellWidth		= gc_tFont.usWidth * gc_usFontScale;
+constexpr uint8_t	gc_usCellPages		= SIMPLE_OLED_CELL_PAGES;
@@ -0,0 +1,211 @@
+//##########################################################################
+//#
+//#		simple_oled_manager.cpp
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Implementation of the class SimpleDisplayManager
+//#	(see simple_oled_manager.h).
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <Arduino.h>
+
+#include "simple_oled_manager.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+//----	Decay of the longest update (see Update())  ------------------------
+//	each call of Update() lowers the longest update by 1/8, so a single
+//	slow update (e.g. a recovery) does not limit the following calls
+//
+#define UPDATE_DECAY_SHIFT				3
+
+
+////////////////////////////////////////////////////////////////////////////
+//
+//	CLASS: SimpleDisplayManager
+//
+
+
+//**************************************************************************
+//	Constructor
+//--------------------------------------------------------------------------
+//
+SimpleDisplayManager::SimpleDisplayManager()
+{
+	m_usDisplays			= 0;
+	m_usNextDisplay			= 0;
+	m_uiMaxUpdateMicros		= 0;
+}
+
+
+//**************************************************************************
+//	Add
+//--------------------------------------------------------------------------
+//	The function adds a display to the manager. The display must be
+//	initialized with its own address (see Init()).
+//	If all is okay or the display was already added then '0' is returned,
+//	if there are already SIMPLE_OLED_MAX_DISPLAYS displays then '1' is
+//	returned.
+//
+uint8_t SimpleDisplayManager::Add( SimpleDisplayClass &clDisplay )
+{
+	for( uint8_t idx = 0 ; idx < m_usDisplays ; idx++ )
+	{
+		if( &clDisplay == m_arpclDisplay[ idx ] )
+		{
+			return( 0 );
+		}
+	}
+
+	if( SIMPLE_OLED_MAX_DISPLAYS <= m_usDisplays )
+	{
+		return( 1 );
+	}
+
+	m_arpclDisplay[ m_usDisplays++ ] = &clDisplay;
+
+	return( 0 );
+}
+
+
+//**************************************************************************
+//	SetAsync
+//--------------------------------------------------------------------------
+//	The function switches the asynchronous mode of all displays on or off
+//	(see SimpleDisplayClass::SetAsync()).
+//
+void SimpleDisplayManager::SetAsync( bool bAsync )
+{
+	for( uint8_t idx = 0 ; idx < m_usDisplays ; idx++ )
+	{
+		m_arpclDisplay[ idx ]->SetAsync( bAsync );
+	}
+}
+
+
+//**************************************************************************
+//	Update
+//--------------------------------------------------------------------------
+//	The function calls Update( 1 ) of the displays in turns, so each call
+//	sends at most one queued transmission of that display and does its
+//	other work (smooth scroll, refresh of the framebuffer, recovery). The
+//	next call continues with the display that is the next one in turn,
+//	so all displays get the same share of the bus.
+//	The calls go on until all displays in a row are idle, but a call is
+//	only started if the longest call measured recently still fits into
+//	the remaining time of uiBudgetMicros. The longest call decays with
+//	each call of this function (see UPDATE_DECAY_SHIFT), so a single
+//	slow call only delays the displays for a short time.
+//	At least one display is updated per call, otherwise a budget that is
+//	too small would stop all output.
+//	The function returns 'true' if there are still transmissions in the
+//	queues.
+//
+bool SimpleDisplayManager::Update( uint16_t uiBudgetMicros )
+{
+	uint32_t	ulStart	= micros();
+	uint8_t		usIdle	= 0;
+	bool		bFirst	= true;
+
+	m_uiMaxUpdateMicros -= m_uiMaxUpdateMicros >> UPDATE_DECAY_SHIFT;
+
+	while( usIdle < m_usDisplays )
+	{
+		SimpleDisplayClass	*pclDisplay = m_arpclDisplay[ m_usNextDisplay ];
+		uint32_t			ulNow		= micros();
+		uint32_t			ulDuration;
+
+		if(		!bFirst
+			&&	(((ulNow - ulStart) + m_uiMaxUpdateMicros) > uiBudgetMicros) )
+		{
+			//--------------------------------------------------------------
+			//	no time left, this display is the first one in the
+			//	next call
+			//
+			return( !IsIdle() );
+		}
+
+		pclDisplay->Update( 1 );
+
+		//------------------------------------------------------------------
+		//	remember the longest recent call
+		//
+		ulDuration = micros() - ulNow;
+
+		if( m_uiMaxUpdateMicros < ulDuration )
+		{
+			m_uiMaxUpdateMicros = (0xFFFF < ulDuration) ? 0xFFFF : (uint16_t)ulDuration;
+		}
+
+		//------------------------------------------------------------------
+		//	stop if all displays in a row have nothing to send
+		//
+		if( pclDisplay->IsIdle() )
+		{
+			usIdle++;
+		}
+		else
+		{
+			usIdle = 0;
+		}
+
+		bFirst = false;
+
+		m_usNextDisplay++;
+
+		if( m_usDisplays <= m_usNextDisplay )
+		{
+			m_usNextDisplay = 0;
+		}
+	}
+
+	return( false );
+}
+
+
+//**************************************************************************
+//	WaitIdle
+//--------------------------------------------------------------------------
+//	The function sends all queued transmissions of all displays before
+//	it returns.
+//
+void SimpleDisplayManager::WaitIdle( void )
+{
+	for( uint8_t idx = 0 ; idx < m_usDisplays ; idx++ )
+	{
+		m_arpclDisplay[ idx ]->WaitIdle();
+	}
+}
+
+
+//**************************************************************************
+//	IsIdle (private)
+//--------------------------------------------------------------------------
+//	The function returns 'true' if the queues of all displays are empty.
+//
+bool SimpleDisplayManager::IsIdle( void )
+{
+	for( uint8_t idx = 0 ; idx < m_usDisplays ; idx++ )
+	{
+		if( !m_arpclDisplay[ idx ]->IsIdle() )
+		{
+			return( false );
+		}
+	}
+
+	return( true );
+}
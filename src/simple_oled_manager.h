@@ -0,0 +1,67 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		simple_oled_manager.h
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This class handles several displays that share one bus.
+//#	The displays work in the asynchronous mode (see SetAsync() of
+//#	SimpleDisplayClass) and the manager sends their queued transmissions
+//#	in turns, one call of Update() per display, within a given time budget.
+//#	So a display with a lot of changes cannot block the others and the
+//#	time spent in loop() for the displays is limited.
+//#
+//#	Without transmit queue (SIMPLE_OLED_TX_QUEUE_SIZE = 0) every display
+//#	sends its transmissions at once and Update() has nothing to do.
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+
+#include "simple_oled_config.h"
+#include "simple_oled_sh1106.h"
+
+
+//==========================================================================
+//
+//		C L A S S   D E F I N I T I O N S
+//
+//==========================================================================
+
+
+////////////////////////////////////////////////////////////////////////////
+//	CLASS: SimpleDisplayManager
+//
+class SimpleDisplayManager
+{
+	public:
+		SimpleDisplayManager();
+
+		uint8_t Add( SimpleDisplayClass &clDisplay );
+
+		inline uint8_t Displays( void )
+		{
+			return( m_usDisplays );
+		};
+
+		void SetAsync( bool bAsync );
+		bool Update( uint16_t uiBudgetMicros );
+		void WaitIdle( void );
+
+	private:
+		SimpleDisplayClass *	m_arpclDisplay[ SIMPLE_OLED_MAX_DISPLAYS ];
+		uint8_t					m_usDisplays;
+		uint8_t					m_usNextDisplay;
+		uint16_t				m_uiMaxUpdateMicros;
+
+		bool IsIdle( void );
+};
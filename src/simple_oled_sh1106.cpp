@@ -18,6 +18,216 @@
 //#
 //#-------------------------------------------------------------------------
 //#
+//#	Version: 1.27	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add SetBusClock() and AutoTuneClock(): the clock of the bus is kept
+//#			when the bus is started again, the auto tune tries 100 kHz, 400 kHz
+//#			and 1 MHz with probes and status reads and keeps the fastest clock
+//#			that works (see simple_oled_config.h: SIMPLE_OLED_WIRE_CLOCK)
+//#		-	transport: GetClock(), SetClock() of the Wire transport
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.26	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add recovery from bus errors: a failed transmission is repeated with a
+//#			doubling pause within a time limit per function call, then the bus is
+//#			cleared and the display is offline until Update() finds it again or
+//#			reads that it was reset, then it is initialized and gets its content
+//#			again (SetRecovery(), IsOnline(), RecoveryCount(), see simple_oled_config.h:
+//#			SIMPLE_OLED_RECOVERY)
+//#		-	transport: SetTimeout(), ClearBus() and ReadStatus()
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.25	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add a trace: the calls of the public functions and the transmissions
+//#			with their bytes and the time since the previous record in a ring of
+//#			records with 4 bytes (DumpTrace(), ClearTrace(), see simple_oled_config.h:
+//#			SIMPLE_OLED_TRACE_SIZE)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.24	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add statistics: transmissions, bytes, address commands, errors, time on
+//#			the bus and the longest call of the public functions (GetStats(),
+//#			ResetStats(), see simple_oled_config.h: SIMPLE_OLED_STATS)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.23	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add SetRefreshRate(): with framebuffer the output only changes the
+//#			framebuffer and Update() transmits the changes at most once per frame
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.22	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add DrawColumn() that writes one pixel column with one byte per page,
+//#			used by the widgets SimpleOledSparkline and SimpleOledBarGraph
+//#			(see simple_oled_widgets.h)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.21	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add graphics: DrawPixel(), DrawHLine(), DrawVLine(), DrawRect(), FillRect()
+//#			and DrawBitmap(), pages that are covered completely are written with
+//#			whole bytes, with framebuffer only the touched columns are flushed
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.20	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add scroll regions for the PrintMode scroll line (SetScrollRegion()),
+//#			the lines of a region are rewritten from the text shadow, the whole
+//#			display is still shifted with the display line offset
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.19	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add the smooth scroll for the PrintMode scroll line, Update() moves
+//#			the display one pixel row per step (SetSmoothScroll(), IsScrolling())
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.18	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add the fonts 6x8 and 8x16 and the scaling of the font by 2 or 3
+//#			(see simple_oled_config.h: SIMPLE_OLED_FONT, SIMPLE_OLED_FONT_SCALE),
+//#			characters higher than one page are sent page by page for the
+//#			whole run of characters
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.17	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add layouts: labels and fields are defined once in PROGMEM,
+//#			ShowLayout() prints the labels, SetField() and SetFieldNumber()
+//#			print only the changed characters of a field
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.16	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add the functions PrintNumber() and PrintFixed() for right-aligned
+//#			number fields
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.15	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	derive the class from the class Print of the Arduino core, write()
+//#			sends the characters directly into the data transmission
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.14	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	keep the display column offset per display, so more displays can be
+//#			used at the same time
+//#		-	fix: Init() rejected the address SECOND_DISPLAY_ADDRESS
+//#		-	add the class SimpleDisplayManager for several displays on one bus
+//#			(see simple_oled_manager.h)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.13	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	keep track of the page and column address of the display RAM and
+//#			send only the parts of the address that have changed
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.12	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	send sequences of commands and the following display data in one
+//#			transmission (command stream), also in Init(), Flip() and SetCursor()
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.11	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add the transports SimpleOledWireTransport, SimpleOledSpiTransport
+//#			and SimpleOledSoftI2cTransport and the function Transport()
+//#			(see simple_oled_config.h: SIMPLE_OLED_TRANSPORT)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.10	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add an optional transmit queue for an asynchronous mode
+//#			and the functions SetAsync(), Update(), WaitIdle() and QueueHighWater()
+//#			(see simple_oled_config.h: SIMPLE_OLED_TX_QUEUE_SIZE)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.09	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	Clear() clears all pages in one pass instead of calling ClearLine()
+//#			for every line, optional blanking of the display while clearing
+//#			(see simple_oled_config.h: SIMPLE_OLED_BLANK_ON_CLEAR)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.08	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	fill every data transmission up to the size of the transmit buffer
+//#			of the Wire library of the platform, also in ClearLine()
+//#			(see simple_oled_config.h: SIMPLE_OLED_WIRE_BUFFER_SIZE)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.07	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add an optional framebuffer with dirty column tracking per page
+//#			and the functions Flush() and SetAutoFlush()
+//#			(see simple_oled_config.h: SIMPLE_OLED_FRAMEBUFFER)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.06	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	keep a copy of the text shown on the display (text shadow)
+//#			and transmit only characters that have changed
+//#			(see simple_oled_config.h: SIMPLE_OLED_TEXT_SHADOW)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.05	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	Print() and PrintLn() collect all characters of a line
+//#			and transmit them in as few I²C transmissions as possible
+//#
+//#-------------------------------------------------------------------------
+//#
 //#	Version: 1.04	Date: 13.12.2022
 //#
 //#	Implementation:
@@ -64,13 +274,19 @@
 //
 //==========================================================================
 
+#include <Arduino.h>
+#include <string.h>
 #include <avr/pgmspace.h>
-#include <Wire.h>
 
 #include "simple_oled_sh1106.h"
 #include "font.h"
 
 
+#if SIMPLE_OLED_FRAMEBUFFER && defined( RAMEND ) && (RAMEND < 0x0FFF)
+#error "SIMPLE_OLED_FRAMEBUFFER needs more RAM than this board has"
+#endif
+
+
 //==========================================================================
 //
 //		D E F I N I T I O N S
@@ -78,13 +294,25 @@
 //==========================================================================
 
 #define DISPLAY_LINES					64
-#define DISPLAY_COLUMNS					132
+#define DISPLAY_COLUMNS					SIMPLE_OLED_COLUMNS
+
+#define	TEXT_LINES						SIMPLE_OLED_TEXT_LINES
+#define TEXT_COLUMNS					SIMPLE_OLED_TEXT_COLUMNS
 
-#define	TEXT_LINES						8
-#define TEXT_COLUMNS					16
+#define PIXELS_PAGE_HEIGHT				8
+#define PIXELS_CHAR_WIDTH				gc_usCellWidth
+#define PAGES_CHAR_HEIGHT				SIMPLE_OLED_CELL_PAGES
+
+//----	Scroll line with the display line offset  --------------------------
+//	only possible if the text lines fill all pages of the display,
+//	otherwise the print mode scroll line continues in the first line
+//
+#define SCROLL_BY_LINE_OFFSET			((TEXT_LINES * PAGES_CHAR_HEIGHT) == SIMPLE_OLED_PAGES)
 
-#define PIXELS_CHAR_HEIGHT				8
-#define PIXELS_CHAR_WIDTH				8
+//----	Smooth scroll  -----------------------------------------------------
+//	display line offset (in pixel rows) of the first row of a text line
+//
+#define SCROLL_ROW( usLineOffset )		((usLineOffset) * PAGES_CHAR_HEIGHT * PIXELS_PAGE_HEIGHT)
 
 #define DISPLAY_LINE_OFFSET_MAX			63
 #define DISPLAY_LINE_OFFSET_MIN			0
@@ -94,11 +322,39 @@
 #define DISPLAY_COLUMN_OFFSET_MIN		0
 #define DISPLAY_COLUMN_OFFSET_DEFAULT	2
 
+//----	Size of the transmit buffer (see simple_oled_sh1106.h)  -----------
+#define I2C_BUFFER_SIZE					SIMPLE_OLED_I2C_BUFFER_SIZE
+
+#if SIMPLE_OLED_TX_QUEUE_SIZE && (SIMPLE_OLED_TX_QUEUE_SIZE <= I2C_BUFFER_SIZE)
+#error "SIMPLE_OLED_TX_QUEUE_SIZE must be larger than the transmit buffer of the Wire library"
+#endif
+
+//----	Text shadow  -------------------------------------------------------
+//	each cell holds the character code, bit 7 is set for inverse font
+//	'0' means that the content of the cell is unknown
+//
+#define SHADOW_UNKNOWN					0x00
+#define SHADOW_INVERSE					0x80
+
+//----	Framebuffer  -------------------------------------------------------
+//	per page the first and the last changed column is stored,
+//	'first > last' means that nothing in this page has changed
+//
+#define DIRTY_NONE_FIRST				0xFF
+#define DIRTY_NONE_LAST					0x00
+
 //----	Print Modes  -------------------------------------------------------
 #define PM_OVERWRITE_SAME_LINE			1
 #define PM_OVERWRITE_NEXT_LINE			2
 #define PM_SCROLL_LINE					3
 
+//----	Scaled fonts  ------------------------------------------------------
+//	SPREAD_BITS( n ) repeats each of the 4 bits of n
+//	SIMPLE_OLED_FONT_HEIGHT_SCALE times, e.g. scale 2: 0101b -> 00110011b
+//
+#define SPREAD_BIT( n, bit )			((((n) >> (bit)) & 1) ? (((1UL << SIMPLE_OLED_FONT_HEIGHT_SCALE) - 1) << ((bit) * SIMPLE_OLED_FONT_HEIGHT_SCALE)) : 0)
+#define SPREAD_BITS( n )				(SPREAD_BIT( n, 0 ) | SPREAD_BIT( n, 1 ) | SPREAD_BIT( n, 2 ) | SPREAD_BIT( n, 3 ))
+
 
 //--------------------------------------------------------------------------
 //	Definitions for I²C protocol
@@ -130,10 +386,99 @@
 #define	MASK_COLUMN_ADDRESS_LOW			0x0F
 #define MASK_COLUMN_ADDRESS_HIGH		0xF0
 
-//----	Idx into command buffer  ---------------------------------------
-#define	IDX_PAGE_ADDRESS				1
-#define IDX_COLUMN_ADDRESS_LOW			3
-#define IDX_COLUMN_ADDRESS_HIGH			5
+//----	RAM address of the display  ------------------------------------
+//	page and column address that the display uses for the next data byte,
+//	'unknown' forces the transmission of the address
+//
+#define RAM_ADDRESS_UNKNOWN				0xFF
+
+//----	Command stream  ------------------------------------------------
+//	in front of data each command needs 2 bytes (prefix and code),
+//	the data block needs at least 2 bytes (prefix and one data byte)
+//
+#define STREAM_COMMAND_BYTES			2
+#define STREAM_DATA_MIN_BYTES			2
+
+//----	Connection to the display (see SIMPLE_OLED_RECOVERY)  ----------
+//	none:	Init() did not find the display, errors are ignored
+//	online:	failed transmissions are repeated
+//	lost:	no transmissions until Update() finds the display again
+//
+#define LINK_NONE						0
+#define LINK_ONLINE						1
+#define LINK_LOST						2
+
+//----	longest pause between two repetitions in µs  -------------------
+#define RETRY_PAUSE_MAX					8000
+
+//----	Auto tune of the bus clock (see AutoTuneClock())  ----------------
+//	each clock is checked with TUNE_CHECKS probes and status reads
+//
+#define TUNE_CHECKS						4
+#define TUNE_CLOCKS						3
+
+//----	Statistics, trace and recovery  ------------------------------------
+//	API_CALL( api ) at the start of a public function records the call
+//	of the group SIMPLE_OLED_API_xxx in the trace (see DumpTrace()),
+//	measures the time until the function returns for the longest call
+//	of the group (see GetStats()) and starts the time limit for the
+//	repetitions of failed transmissions of the outermost call (see
+//	SetRecovery()), without statistics, trace and recovery it is empty
+//
+#if SIMPLE_OLED_STATS || SIMPLE_OLED_TRACE_SIZE || SIMPLE_OLED_RECOVERY
+class SimpleDisplayClass::ApiCall
+{
+	public:
+		inline ApiCall( SimpleDisplayClass *pclDisplay, uint8_t usApi )
+		{
+			m_pclDisplay	= pclDisplay;
+			m_usApi			= usApi;
+
+#if SIMPLE_OLED_RECOVERY
+			if( 0 == m_pclDisplay->m_usApiDepth++ )
+			{
+				m_pclDisplay->m_ulRetryMicros = 0;
+			}
+#endif
+
+#if SIMPLE_OLED_TRACE_SIZE
+			m_pclDisplay->Trace( SIMPLE_OLED_TRACE_API_BEGIN, usApi );
+#endif
+#if SIMPLE_OLED_STATS
+			m_ulStart		= micros();
+#endif
+		};
+
+		inline ~ApiCall()
+		{
+#if SIMPLE_OLED_STATS
+			uint32_t	ulMicros = micros() - m_ulStart;
+
+			if( m_pclDisplay->m_tStats.arulMaxMicros[ m_usApi ] < ulMicros )
+			{
+				m_pclDisplay->m_tStats.arulMaxMicros[ m_usApi ] = ulMicros;
+			}
+#endif
+#if SIMPLE_OLED_TRACE_SIZE
+			m_pclDisplay->Trace( SIMPLE_OLED_TRACE_API_END, m_usApi );
+#endif
+#if SIMPLE_OLED_RECOVERY
+			m_pclDisplay->m_usApiDepth--;
+#endif
+		};
+
+	private:
+		SimpleDisplayClass *	m_pclDisplay;
+		uint8_t					m_usApi;
+#if SIMPLE_OLED_STATS
+		uint32_t				m_ulStart;
+#endif
+};
+
+#define API_CALL( usApi )				ApiCall		clApiCall( this, usApi )
+#else
+#define API_CALL( usApi )
+#endif
 
 
 //==========================================================================
@@ -144,16 +489,39 @@
 
 SimpleDisplayClass	g_clDisplay	= SimpleDisplayClass();
 
-uint8_t		g_usDisplayColumnOffset	= DISPLAY_COLUMN_OFFSET_DEFAULT;
-uint8_t		g_arusPositionCommandBuffer[] =
-	{
-		PREFIX_NEXT_COMMAND,
-		OPC_PAGE_ADDRESS,
-		PREFIX_NEXT_COMMAND,
-		OPC_COLUMN_ADDRESS_LOW,
-		PREFIX_LAST_COMMAND,
-		OPC_COLUMN_ADDRESS_HIGH
-	};
+#if 1 < SIMPLE_OLED_FONT_HEIGHT_SCALE
+//--------------------------------------------------------------------------
+//	lookup table to scale the columns of a glyph, each entry holds the
+//	4 bits of its index spread to 4 * SIMPLE_OLED_FONT_HEIGHT_SCALE bits
+//	(more than 16 bits only for the 8x16 font with scale 3)
+//
+#if 4 < SIMPLE_OLED_FONT_HEIGHT_SCALE
+static const uint32_t	g_aruiSpreadBits[ 16 ] PROGMEM =
+#define READ_SPREAD_BITS( n )			pgm_read_dword( &g_aruiSpreadBits[ n ] )
+#else
+static const uint16_t	g_aruiSpreadBits[ 16 ] PROGMEM =
+#define READ_SPREAD_BITS( n )			pgm_read_word( &g_aruiSpreadBits[ n ] )
+#endif
+{
+	SPREAD_BITS(  0 ),	SPREAD_BITS(  1 ),	SPREAD_BITS(  2 ),	SPREAD_BITS(  3 ),
+	SPREAD_BITS(  4 ),	SPREAD_BITS(  5 ),	SPREAD_BITS(  6 ),	SPREAD_BITS(  7 ),
+	SPREAD_BITS(  8 ),	SPREAD_BITS(  9 ),	SPREAD_BITS( 10 ),	SPREAD_BITS( 11 ),
+	SPREAD_BITS( 12 ),	SPREAD_BITS( 13 ),	SPREAD_BITS( 14 ),	SPREAD_BITS( 15 )
+};
+#endif
+
+#if SIMPLE_OLED_TRANSPORT != SIMPLE_OLED_TRANSPORT_SPI
+//--------------------------------------------------------------------------
+//	clocks of the I²C bus that are tried by AutoTuneClock(), the slowest
+//	first
+//
+static const uint32_t	g_arulTuneClock[ TUNE_CLOCKS ] PROGMEM =
+{
+	SIMPLE_OLED_CLOCK_STANDARD,
+	SIMPLE_OLED_CLOCK_FAST,
+	SIMPLE_OLED_CLOCK_FAST_PLUS
+};
+#endif
 
 
 ////////////////////////////////////////////////////////////////////////////
@@ -169,6 +537,56 @@ uint8_t		g_arusPositionCommandBuffer[] =
 //
 SimpleDisplayClass::SimpleDisplayClass()
 {
+	m_usColumnOffset	= DISPLAY_COLUMN_OFFSET_DEFAULT;
+	m_ptLayout			= NULL;
+	m_uiStreamBytes		= 0;
+	m_usStreamCommands	= 0;
+	m_bStreamData		= false;
+	m_bPositionValid	= false;
+	m_usRamPage			= RAM_ADDRESS_UNKNOWN;
+	m_usRamColumn		= RAM_ADDRESS_UNKNOWN;
+
+#if SIMPLE_OLED_READ_BACK
+	m_usReadColumn		= 0;
+	m_usReadBytes		= 0;
+	m_usSpanEnd			= 0;
+#endif
+
+#if 1 < SIMPLE_OLED_CELL_PAGES
+	m_usRunLength		= 0;
+#endif
+
+	m_usScrollFirst			= 0;
+	m_usScrollLast			= TEXT_LINES - 1;
+	m_bSmoothScroll			= false;
+	m_usScrollStepMillis	= SIMPLE_OLED_SCROLL_STEP_MILLIS;
+	m_usScrollRow			= 0;
+	m_uiScrollStepTime		= 0;
+
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+	m_uiQueueHead		= 0;
+	m_uiQueueTail		= 0;
+	m_uiQueueUsed		= 0;
+	m_uiQueueHighWater	= 0;
+	m_bAsync			= false;
+#endif
+
+#if SIMPLE_OLED_RECOVERY
+	m_uiRetryBytes		= 0;
+	m_usRetries			= SIMPLE_OLED_RETRIES;
+	m_usMaxBlockMillis	= SIMPLE_OLED_MAX_BLOCK_MILLIS;
+	m_ulRetryMicros		= 0;
+	m_usApiDepth		= 0;
+	m_usLink			= LINK_NONE;
+	m_uiLinkTime		= 0;
+	m_uiRecoveries		= 0;
+	m_bFlip				= false;
+	m_bInverseDisplay	= false;
+#endif
+
+	ResetStats();
+	ClearTrace();
+	InvalidateTextShadow();
 }
 
 
@@ -181,22 +599,44 @@ SimpleDisplayClass::SimpleDisplayClass()
 //
 uint8_t SimpleDisplayClass::Init( uint8_t address )
 {
+	API_CALL( SIMPLE_OLED_API_INIT );
+
 	uint8_t	usError;
 
 
 	//------------------------------------------------------------------
 	//	set initial values for internal variables
 	//
-	m_usTextLine	= 0;
-	m_usTextColumn	= 0;
-	m_usPrintMode	= PM_SCROLL_LINE;
-	m_usLineOffset	= 0;
-	m_bInverse		= false;
+	m_usTextLine			= 0;
+	m_usTextColumn			= 0;
+	m_usPrintMode			= PM_SCROLL_LINE;
+	m_usLineOffset			= 0;
+	m_uiStreamBytes			= 0;
+	m_usStreamCommands		= 0;
+	m_bStreamData			= false;
+	m_bInverse				= false;
+
+	//------------------------------------------------------------------
+	//	the content of the display is unknown until it is cleared
+	//
+	InvalidateTextShadow();
+
+#if SIMPLE_OLED_FRAMEBUFFER
+	memset( m_arusFrame, 0x00, sizeof( m_arusFrame ) );
+	memset( m_arusDirtyFirst, 0, sizeof( m_arusDirtyFirst ) );
+	memset( m_arusDirtyLast, DISPLAY_COLUMNS - 1, sizeof( m_arusDirtyLast ) );
+
+	m_usWritePage	= 0;
+	m_usWriteColumn	= 0;
+	m_bAutoFlush	= true;
+	m_uiFrameMillis	= 0;
+	m_uiFrameTime	= 0;
+#endif
 
 	//------------------------------------------------------------------
 	//	Check the given address
 	//
-	if( !(DISPLAY_ADDRESS == address) || (SECOND_DISPLAY_ADDRESS == address) )
+	if( (DISPLAY_ADDRESS != address) && (SECOND_DISPLAY_ADDRESS != address) )
 	{
 		//----------------------------------------------------------
 		//	no valid address
@@ -204,13 +644,39 @@ uint8_t SimpleDisplayClass::Init( uint8_t address )
 		return( 1 );
 	}
 
-	Wire.begin();
+	//------------------------------------------------------------------
+	//	transmissions that are still queued belong to the old address
+	//
+	WaitIdle();
+
+	m_clTransport.Begin();
 
 	//------------------------------------------------------------------
 	//	Check if Display can be connected under the given address
 	//
-	Wire.beginTransmission( address );
-	usError = Wire.endTransmission();
+#if SIMPLE_OLED_TRACE_SIZE
+	Trace( SIMPLE_OLED_TRACE_TX_BEGIN, 0 );
+#endif
+
+	usError = m_clTransport.Probe( address );
+
+#if SIMPLE_OLED_STATS
+	m_tStats.ulTransactions++;
+
+	if( 0 != usError )
+	{
+		m_tStats.ulErrors++;
+	}
+#endif
+
+#if SIMPLE_OLED_TRACE_SIZE
+	if( 0 != usError )
+	{
+		Trace( SIMPLE_OLED_TRACE_TX_ERROR, usError );
+	}
+
+	Trace( SIMPLE_OLED_TRACE_TX_END, 0 );
+#endif
 
 	if( 0 == usError )
 	{
@@ -218,8 +684,21 @@ uint8_t SimpleDisplayClass::Init( uint8_t address )
 		//	YES the display can be connected with the given address
 		//	so initialize the display
 		//
-		m_usAddress	= address;
+		m_usAddress		= address;
+		m_usRamPage		= RAM_ADDRESS_UNKNOWN;
+		m_usRamColumn	= RAM_ADDRESS_UNKNOWN;
 
+#if SIMPLE_OLED_RECOVERY
+		m_usLink			= LINK_ONLINE;
+		m_uiLinkTime		= (uint16_t)millis();
+		m_bFlip				= false;
+		m_bInverseDisplay	= false;
+#endif
+
+		//----------------------------------------------------------
+		//	the commands go out together with the first page
+		//	that is cleared
+		//
 		SendCommand( OPC_DISPLAY_LINE_OFFSET, 0 );
 		SendCommand( OPC_ENTIRE_DISPLAY_NORMAL );
 		SendCommand( OPC_DISPLAY_ON );
@@ -227,6 +706,12 @@ uint8_t SimpleDisplayClass::Init( uint8_t address )
 		SendCommand( OPC_OUTPUT_SCAN_NORMAL );
 		Clear();
 	}
+#if SIMPLE_OLED_RECOVERY
+	else
+	{
+		m_usLink = LINK_NONE;
+	}
+#endif
 	
 	return( usError );
 }
@@ -261,14 +746,14 @@ uint8_t SimpleDisplayClass::MaxTextColumns( void )
 //--------------------------------------------------------------------------
 //	The function sets the cursor to the given line and column
 //	valid values are:
-//		line:	0 -  7
-//		column:	0 - 15
+//		line:	0 - MaxTextLines() - 1		(e.g. 0 -  7 with the 8x8 font)
+//		column:	0 - MaxTextColumns() - 1	(e.g. 0 - 15 with the 8x8 font)
+//	The position is sent to the display together with the next character
+//	that is printed, so no extra transmission is needed.
 //
 void SimpleDisplayClass::SetCursor( uint8_t usTextLine, uint8_t usTextColumn )
 {
-	uint8_t		usAddressLow;
-	uint8_t		usAddressHigh;
-
+	API_CALL( SIMPLE_OLED_API_CURSOR );
 
 	if( (TEXT_LINES > usTextLine) && (TEXT_COLUMNS > usTextColumn) )
 	{
@@ -278,46 +763,7 @@ void SimpleDisplayClass::SetCursor( uint8_t usTextLine, uint8_t usTextColumn )
 		m_usTextLine	= usTextLine;
 		m_usTextColumn	= usTextColumn;
 
-		//------------------------------------------------------------------
-		//	take care of the display line shift
-		//	and correct the text line accordingly
-		//
-		usTextLine += m_usLineOffset;
-
-		if( TEXT_LINES <= usTextLine )
-		{
-			usTextLine -= TEXT_LINES;
-		}
-
-		//------------------------------------------------------------------
-		//	preparation for the command that will be send to the display
-		//
-		usTextLine &= MASK_PAGE_ADDRESS;
-		g_arusPositionCommandBuffer[ IDX_PAGE_ADDRESS ] = usTextLine | OPC_PAGE_ADDRESS;
-
-		//------------------------------------------------------------------
-		//	calculate bit column
-		//	the calculated bit column is the start column of a character
-		//
-		usTextColumn <<= 3;		//	multiply by 8
-		usTextColumn  += g_usDisplayColumnOffset;
-
-		//------------------------------------------------------------------
-		//	preparation for the commands that will be send to the display
-		//
-		usAddressLow	 = usTextColumn & MASK_COLUMN_ADDRESS_LOW;
-		g_arusPositionCommandBuffer[ IDX_COLUMN_ADDRESS_LOW  ] = usAddressLow | OPC_COLUMN_ADDRESS_LOW;
-
-		usAddressHigh	 = usTextColumn & MASK_COLUMN_ADDRESS_HIGH;
-		usAddressHigh >>= 4;
-		g_arusPositionCommandBuffer[ IDX_COLUMN_ADDRESS_HIGH ] = usAddressHigh | OPC_COLUMN_ADDRESS_HIGH;
-
-		//------------------------------------------------------------------
-		//	now send the commands to position the cursor to the display
-		//
-		Wire.beginTransmission( m_usAddress );
-		Wire.write( g_arusPositionCommandBuffer, sizeof( g_arusPositionCommandBuffer ) );
-		Wire.endTransmission();
+		m_bPositionValid = false;
 	}
 }
 
@@ -335,62 +781,53 @@ void SimpleDisplayClass::SetCursor( uint8_t usTextLine, uint8_t usTextColumn )
 //
 void SimpleDisplayClass::PrintChar( uint8_t usCharIdx )
 {
-	uint16_t		uiHelper;
-	const uint8_t *	pusActualColumn;
-	uint8_t			usLetterColumn;
+	API_CALL( SIMPLE_OLED_API_PRINT );
 
-	if( '\n' == usCharIdx )
-	{
-		NextLine( true );
-	}
-	else if( (' ' <= usCharIdx) && (128 > usCharIdx) )
-	{
-		//--------------------------------------------------------------
-		//	if we reached the end of the line then depending of the
-		//	PrintMode continue in the 'next line'
-		//
-		if( TEXT_COLUMNS <= m_usTextColumn )
-		{
-			NextLine( false );
-		}
+	WriteGlyph( usCharIdx );
+	EndData();
+}
 
-		//--------------------------------------------------------------
-		//	this is a printable character, so calculate the pointer
-		//	into the font array to that position where the bitmap of
-		//	this character starts
-		//
-		uiHelper   = usCharIdx - 32;
-		uiHelper <<= 3;	//	mit 8 multiplizieren
 
-		pusActualColumn = &font8x8_simple[ 0 ] + uiHelper;
+//**************************************************************************
+//	write
+//--------------------------------------------------------------------------
+//	Interface to the class Print of the Arduino core.
+//	print() and println() of the Arduino core write single characters
+//	with this function. It works like PrintChar(), '\r' is ignored.
+//
+size_t SimpleDisplayClass::write( uint8_t usData )
+{
+	API_CALL( SIMPLE_OLED_API_PRINT );
 
-		//--------------------------------------------------------------
-		//	transmit the bitmap of the character to the display
-		//
-		Wire.beginTransmission( m_usAddress );
+	WriteGlyph( usData );
+	EndData();
 
-		Wire.write( PREFIX_DATA );
+	return( 1 );
+}
 
-		for( uint8_t idx = 0 ; idx < PIXELS_CHAR_WIDTH ; idx++ )
-		{
-			usLetterColumn = pgm_read_byte( pusActualColumn );
-			pusActualColumn++;
 
-			if( m_bInverse )
-			{
-				usLetterColumn = ~usLetterColumn;
-			}
+//**************************************************************************
+//	write
+//--------------------------------------------------------------------------
+//	Interface to the class Print of the Arduino core.
+//	print() and println() of the Arduino core write strings and
+//	converted numbers with this function. The characters go directly
+//	into the data transmission, like with Print( text ), so there is no
+//	need for a buffer and all characters of a line are transmitted
+//	together.
+//
+size_t SimpleDisplayClass::write( const uint8_t *pusBuffer, size_t uiSize )
+{
+	API_CALL( SIMPLE_OLED_API_PRINT );
 
-			Wire.write( usLetterColumn );
-		}
+	for( size_t idx = 0 ; idx < uiSize ; idx++ )
+	{
+		WriteGlyph( pusBuffer[ idx ] );
+	}
 
-		Wire.endTransmission();
+	EndData();
 
-		//--------------------------------------------------------------
-		//	one character printed, so move cursor
-		//
-		m_usTextColumn++;
-	}
+	return( uiSize );
 }
 
 
@@ -405,17 +842,24 @@ void SimpleDisplayClass::PrintChar( uint8_t usCharIdx )
 //	PrintMode the cursor will be set to the beginning of the (next) line
 //	and the text output will continue there.
 //
+//	All characters that are printed into the same line are transmitted
+//	together in as few I²C transmissions as possible.
+//
 void SimpleDisplayClass::Print( const __FlashStringHelper* cstrText )
 {
+	API_CALL( SIMPLE_OLED_API_PRINT );
+
 	PGM_P	pText		= reinterpret_cast<PGM_P>( cstrText );
 	uint8_t	usCharIdx	= pgm_read_byte( pText++ );
 
 	while( 0x00 != usCharIdx )
 	{
-		PrintChar( usCharIdx );
+		WriteGlyph( usCharIdx );
 
 		usCharIdx = pgm_read_byte( pText++ );
 	}
+
+	EndData();
 }
 
 
@@ -433,6 +877,8 @@ void SimpleDisplayClass::Print( const __FlashStringHelper* cstrText )
 //
 void SimpleDisplayClass::PrintLn( const __FlashStringHelper* cstrText )
 {
+	API_CALL( SIMPLE_OLED_API_PRINT );
+
 	Print( cstrText );
 	NextLine( true );
 }
@@ -449,16 +895,23 @@ void SimpleDisplayClass::PrintLn( const __FlashStringHelper* cstrText )
 //	PrintMode the cursor will be set to the beginning of the (next) line
 //	and the text output will continue there.
 //
+//	All characters that are printed into the same line are transmitted
+//	together in as few I²C transmissions as possible.
+//
 void SimpleDisplayClass::Print( char* strText )
 {
+	API_CALL( SIMPLE_OLED_API_PRINT );
+
 	uint8_t	usCharIdx	= *strText++;
 
 	while( 0x00 != usCharIdx )
 	{
-		PrintChar( usCharIdx );
+		WriteGlyph( usCharIdx );
 
 		usCharIdx = *strText++;
 	}
+
+	EndData();
 }
 
 
@@ -476,255 +929,2974 @@ void SimpleDisplayClass::Print( char* strText )
 //
 void SimpleDisplayClass::PrintLn( char* strText )
 {
+	API_CALL( SIMPLE_OLED_API_PRINT );
+
 	Print( strText );
 	NextLine( true );
 }
 
 
 //**************************************************************************
-//	Clear
+//	PrintNumber
 //--------------------------------------------------------------------------
-//	The function deletes all text shown on the display.
+//	This function prints the given value right-aligned into a field of
+//	usWidth characters that starts at the given line and column.
+//	(see PrintFixed())
 //
-void SimpleDisplayClass::Clear( void )
+void SimpleDisplayClass::PrintNumber( uint8_t usTextLine, uint8_t usTextColumn, uint8_t usWidth, int32_t lValue )
 {
-	for( m_usTextLine = 0 ; m_usTextLine < TEXT_LINES ; m_usTextLine++ )
-	{
-		ClearLine();
+	API_CALL( SIMPLE_OLED_API_FIELD );
+
+	PrintFixed( usTextLine, usTextColumn, usWidth, lValue, 0 );
+}
+
+
+//**************************************************************************
+//	PrintFixed
+//--------------------------------------------------------------------------
+//	This function prints a fixed point value right-aligned into a field
+//	of usWidth characters that starts at the given line and column.
+//	lValue holds the value multiplied by 10^usDecimals,
+//	e.g. lValue = 1263 and usDecimals = 2 prints "12.63".
+//	The characters in front of the value are filled with spaces. If the
+//	value does not fit into the field then the field is filled with '*'.
+//	The field ends at the end of the line at the latest.
+//
+//	The text is built in a small buffer on the stack, there is no need
+//	for sprintf(). With the text shadow (SIMPLE_OLED_TEXT_SHADOW) only
+//	the characters that differ from the last output are transmitted,
+//	so a counter that changes from 1234 to 1235 costs one character.
+//	After the output the cursor is behind the field.
+//
+void SimpleDisplayClass::PrintFixed(	uint8_t usTextLine,
+										uint8_t usTextColumn,
+										uint8_t usWidth,
+										int32_t lValue,
+										uint8_t usDecimals )
+{
+	API_CALL( SIMPLE_OLED_API_FIELD );
+
+	char	arcField[ TEXT_COLUMNS ];
+
+	if( (TEXT_LINES <= usTextLine) || (TEXT_COLUMNS <= usTextColumn) )
+	{
+		return;
+	}
+
+	if( (TEXT_COLUMNS - usTextColumn) < usWidth )
+	{
+		usWidth = TEXT_COLUMNS - usTextColumn;
+	}
+
+	FormatFixed( arcField, usWidth, lValue, usDecimals );
+
+	//------------------------------------------------------------------
+	//	print the field
+	//
+	SetCursor( usTextLine, usTextColumn );
+
+	for( uint8_t idx = 0 ; idx < usWidth ; idx++ )
+	{
+		WriteGlyph( arcField[ idx ] );
+	}
+
+	EndData();
+}
+
+
+//**************************************************************************
+//	ShowLayout
+//--------------------------------------------------------------------------
+//	This function clears the display and shows the given layout.
+//	The layout (labels, fields and the layout itself) must be stored in
+//	PROGMEM (see SimpleOledLayout).
+//	The labels are printed once, the fields are empty. The values of the
+//	fields are printed with SetField() and SetFieldNumber().
+//
+void SimpleDisplayClass::ShowLayout( const SimpleOledLayout *ptLayout )
+{
+	API_CALL( SIMPLE_OLED_API_FIELD );
+
+	SimpleOledLayout	tLayout;
+	bool				bInverse = m_bInverse;
+
+	m_ptLayout = ptLayout;
+
+	memcpy_P( &tLayout, ptLayout, sizeof( tLayout ) );
+
+	Clear();
+
+	for( uint8_t idx = 0 ; idx < tLayout.usLabels ; idx++ )
+	{
+		SimpleOledLabel	tLabel;
+
+		memcpy_P( &tLabel, &tLayout.ptLabels[ idx ], sizeof( tLabel ) );
+
+		m_bInverse = (0 != (tLabel.usFormat & SIMPLE_OLED_INVERSE));
+
+		SetCursor( tLabel.usTextLine, tLabel.usTextColumn );
+		Print( reinterpret_cast<const __FlashStringHelper *>( tLabel.pstrText ) );
+	}
+
+	//------------------------------------------------------------------
+	//	empty fields are only visible with inverse font
+	//
+	for( uint8_t idx = 0 ; idx < tLayout.usFields ; idx++ )
+	{
+		WriteField( idx, "", 0 );
+	}
+
+	m_bInverse = bInverse;
+}
+
+
+//**************************************************************************
+//	SetField
+//--------------------------------------------------------------------------
+//	This function prints the given text into the field with the index
+//	usField of the actual layout (see ShowLayout()).
+//	The text is aligned as defined for the field, text that is longer
+//	than the field is cut. Only the characters that have changed are
+//	transmitted (with text shadow).
+//
+void SimpleDisplayClass::SetField( uint8_t usField, const char *strText )
+{
+	API_CALL( SIMPLE_OLED_API_FIELD );
+
+	size_t	uiLength = strlen( strText );
+
+	WriteField( usField, strText, (TEXT_COLUMNS < uiLength) ? TEXT_COLUMNS : (uint8_t)uiLength );
+}
+
+
+//**************************************************************************
+//	SetField
+//--------------------------------------------------------------------------
+//	Same as above, but the text is stored in PROGMEM.
+//
+void SimpleDisplayClass::SetField( uint8_t usField, const __FlashStringHelper *cstrText )
+{
+	API_CALL( SIMPLE_OLED_API_FIELD );
+
+	PGM_P	pText		= reinterpret_cast<PGM_P>( cstrText );
+	char	arcText[ TEXT_COLUMNS ];
+	uint8_t	usLength	= 0;
+
+	while( TEXT_COLUMNS > usLength )
+	{
+		arcText[ usLength ] = pgm_read_byte( pText++ );
+
+		if( 0x00 == arcText[ usLength ] )
+		{
+			break;
+		}
+
+		usLength++;
+	}
+
+	WriteField( usField, arcText, usLength );
+}
+
+
+//**************************************************************************
+//	SetFieldNumber
+//--------------------------------------------------------------------------
+//	This function prints a number or a fixed point value (see
+//	PrintFixed()) into the field with the index usField of the actual
+//	layout. The number is aligned as defined for the field.
+//
+void SimpleDisplayClass::SetFieldNumber( uint8_t usField, int32_t lValue, uint8_t usDecimals )
+{
+	API_CALL( SIMPLE_OLED_API_FIELD );
+
+	SimpleOledField	tField;
+	char			arcField[ TEXT_COLUMNS ];
+	uint8_t			usWidth;
+	uint8_t			usStart	= 0;
+
+	if( !ReadField( usField, &tField ) )
+	{
+		return;
+	}
+
+	usWidth = tField.usWidth;
+
+	if( (TEXT_COLUMNS - tField.usTextColumn) < usWidth )
+	{
+		usWidth = TEXT_COLUMNS - tField.usTextColumn;
+	}
+
+	FormatFixed( arcField, usWidth, lValue, usDecimals );
+
+	while( (usStart < usWidth) && (' ' == arcField[ usStart ]) )
+	{
+		usStart++;
+	}
+
+	WriteField( usField, &arcField[ usStart ], usWidth - usStart );
+}
+
+
+//**************************************************************************
+//	DrawRect
+//--------------------------------------------------------------------------
+//	This function draws the frame of a rectangle with the top left corner
+//	at usX (0..127) and usY (0..63) in pixels. bOn = true sets the pixels,
+//	bOn = false clears them. The parts outside the display are clipped.
+//	The pages with the top or the bottom line are written in one run of
+//	columns, so the corners are correct also without framebuffer. The
+//	other pages need only the bytes of the left and the right column.
+//
+void SimpleDisplayClass::DrawRect( uint8_t usX, uint8_t usY, uint8_t usWidth, uint8_t usHeight, bool bOn )
+{
+	API_CALL( SIMPLE_OLED_API_GRAPHICS );
+
+	uint16_t	uiRight		= usX + usWidth - 1;
+	uint16_t	uiBottom	= usY + usHeight - 1;
+	uint8_t		usBits		= bOn ? 0xFF : 0x00;
+	uint8_t		usRow		= usY;
+
+	if( !ClipArea( usX, usY, &usWidth, &usHeight ) )
+	{
+		return;
+	}
+
+	while( (usY + usHeight) > usRow )
+	{
+		uint8_t	usMask	= RowMask( usRow, usY + usHeight );
+		uint8_t	usEdge	= 0;
+
+		//--------------------------------------------------------------
+		//	bits of the top and the bottom line in this page
+		//
+		if( usRow == usY )
+		{
+			usEdge |= (1 << (usY % PIXELS_PAGE_HEIGHT));
+		}
+
+		if( (uiBottom / PIXELS_PAGE_HEIGHT) == (usRow / PIXELS_PAGE_HEIGHT) )
+		{
+			usEdge |= (1 << (uiBottom % PIXELS_PAGE_HEIGHT));
+		}
+
+		if( 0 != usEdge )
+		{
+			SetGraphicPosition( usRow, usX, usWidth );
+
+			for( uint8_t idx = 0 ; idx < usWidth ; idx++ )
+			{
+				if( (0 == idx) || (uiRight == (uint16_t)(usX + idx)) )
+				{
+					WriteBits( usMask, usBits );
+				}
+				else
+				{
+					WriteBits( usEdge, usBits );
+				}
+			}
+		}
+		else
+		{
+			SetGraphicPosition( usRow, usX, 1 );
+			WriteBits( usMask, usBits );
+
+			if( (SIMPLE_OLED_VISIBLE_COLUMNS > uiRight) && (usX != uiRight) )
+			{
+				SetGraphicPosition( usRow, uiRight, 1 );
+				WriteBits( usMask, usBits );
+			}
+		}
+
+		usRow = (usRow | (PIXELS_PAGE_HEIGHT - 1)) + 1;
+	}
+
+	m_bPositionValid = false;
+
+	EndData();
+}
+
+
+//**************************************************************************
+//	FillRect
+//--------------------------------------------------------------------------
+//	This function fills a rectangle with the top left corner at usX
+//	(0..127) and usY (0..63) in pixels. bOn = true sets the pixels,
+//	bOn = false clears them. The parts outside the display are clipped.
+//	DrawPixel(), DrawHLine() and DrawVLine() are rectangles of one pixel
+//	height or width.
+//
+//	Only the pixels of the rectangle are changed. With framebuffer
+//	Flush() sends only the touched columns of each page. Without
+//	framebuffer the bytes are sent directly, the bytes of a page that is
+//	covered only partly are read back from the display first (see
+//	WriteBits()). The 4-wire SPI interface can not read the display RAM,
+//	so there without framebuffer the other pixels of such a page are
+//	cleared.
+//	Text characters under the rectangle are marked as unknown in the
+//	text shadow and will be written again by the next text output.
+//
+void SimpleDisplayClass::FillRect( uint8_t usX, uint8_t usY, uint8_t usWidth, uint8_t usHeight, bool bOn )
+{
+	API_CALL( SIMPLE_OLED_API_GRAPHICS );
+
+	FillArea( usX, usY, usWidth, usHeight, bOn );
+
+	m_bPositionValid = false;
+
+	EndData();
+}
+
+
+//**************************************************************************
+//	DrawBitmap
+//--------------------------------------------------------------------------
+//	This function copies a bitmap from PROGMEM to the display with the
+//	top left corner at usX (0..127) and usY (0..63) in pixels.
+//	The bitmap has the format of the font: one byte per column and page
+//	of 8 rows, bit 0 is the top row. The bytes of the first page of all
+//	usWidth columns come first, then the bytes of the next page, etc.
+//	If usY is a multiple of 8 the bytes go to the display as they are,
+//	otherwise the bytes of two pages of the bitmap are shifted together.
+//	Pixels and text shadow are handled like FillRect() does.
+//
+void SimpleDisplayClass::DrawBitmap( uint8_t usX, uint8_t usY, uint8_t usWidth, uint8_t usHeight, const uint8_t *pusBitmap )
+{
+	API_CALL( SIMPLE_OLED_API_GRAPHICS );
+
+	uint8_t	usStride	= usWidth;
+	uint8_t	usShift		= usY % PIXELS_PAGE_HEIGHT;
+	uint8_t	usPages;
+	uint8_t	usRow		= usY;
+	uint8_t	usPage		= 0;
+
+	if( !ClipArea( usX, usY, &usWidth, &usHeight ) )
+	{
+		return;
+	}
+
+	usPages = (usHeight + PIXELS_PAGE_HEIGHT - 1) / PIXELS_PAGE_HEIGHT;
+
+	while( (usY + usHeight) > usRow )
+	{
+		uint8_t			usMask	= RowMask( usRow, usY + usHeight );
+		const uint8_t *	pusLow	= NULL;
+		const uint8_t *	pusHigh	= NULL;
+
+		//--------------------------------------------------------------
+		//	the rows of this page come from the lower part of bitmap page
+		//	usPage and the upper part of the bitmap page above
+		//
+		if( usPage < usPages )
+		{
+			pusLow = &pusBitmap[ usPage * usStride ];
+		}
+
+		if( (0 < usShift) && (0 < usPage) )
+		{
+			pusHigh = &pusBitmap[ (usPage - 1) * usStride ];
+		}
+
+		SetGraphicPosition( usRow, usX, usWidth );
+
+		for( uint8_t idx = 0 ; idx < usWidth ; idx++ )
+		{
+			uint8_t	usBits = 0;
+
+			if( NULL != pusLow )
+			{
+				usBits = pgm_read_byte( &pusLow[ idx ] ) << usShift;
+			}
+
+			if( NULL != pusHigh )
+			{
+				usBits |= pgm_read_byte( &pusHigh[ idx ] ) >> (PIXELS_PAGE_HEIGHT - usShift);
+			}
+
+			WriteBits( usMask, usBits );
+		}
+
+		usRow = (usRow | (PIXELS_PAGE_HEIGHT - 1)) + 1;
+		usPage++;
+	}
+
+	m_bPositionValid = false;
+
+	EndData();
+}
+
+
+//**************************************************************************
+//	DrawColumn
+//--------------------------------------------------------------------------
+//	This function writes the pixel column usX from the row usY to the
+//	row usY + usHeight - 1: the rows usFirstRow to usLastRow are set,
+//	the other rows are cleared. usFirstRow > usLastRow clears the whole
+//	span. Only one byte per page is transmitted, so this is the cheapest
+//	way to draw one column of a graph (see simple_oled_widgets.h).
+//	If the span is page aligned the result is the same with and without
+//	framebuffer, otherwise pixels and text shadow are handled like
+//	FillRect() does.
+//
+void SimpleDisplayClass::DrawColumn( uint8_t usX, uint8_t usY, uint8_t usHeight, uint8_t usFirstRow, uint8_t usLastRow )
+{
+	API_CALL( SIMPLE_OLED_API_GRAPHICS );
+
+	uint8_t	usWidth	= 1;
+	uint8_t	usRow	= usY;
+
+	if( !ClipArea( usX, usY, &usWidth, &usHeight ) )
+	{
+		return;
+	}
+
+	while( (usY + usHeight) > usRow )
+	{
+		uint8_t	usPageTop	= usRow - (usRow % PIXELS_PAGE_HEIGHT);
+		uint8_t	usPageEnd	= usPageTop + PIXELS_PAGE_HEIGHT;
+		uint8_t	usBits		= 0;
+
+		if( (usFirstRow <= usLastRow) && (usFirstRow < usPageEnd) && (usLastRow >= usPageTop) )
+		{
+			usBits = RowMask(	(usFirstRow > usPageTop) ? usFirstRow : usPageTop,
+								(usLastRow < usPageEnd) ? (usLastRow + 1) : usPageEnd );
+		}
+
+		SetGraphicPosition( usRow, usX, 1 );
+		WriteBits( RowMask( usRow, usY + usHeight ), usBits );
+
+		usRow = usPageEnd;
+	}
+
+	m_bPositionValid = false;
+
+	EndData();
+}
+
+
+//**************************************************************************
+//	Clear
+//--------------------------------------------------------------------------
+//	The function deletes all text shown on the display.
+//
+//	All pages of the display are cleared in one pass: per page one
+//	positioning command followed by the zero bytes of the page in as few
+//	transmissions as the transmit buffer allows.
+//	With SIMPLE_OLED_BLANK_ON_CLEAR the display is switched off while it
+//	is cleared, so the clearing is not visible.
+//	Commands that are still in the command stream (e.g. from Flip())
+//	are sent together with the first page.
+//
+void SimpleDisplayClass::Clear( void )
+{
+	API_CALL( SIMPLE_OLED_API_CLEAR );
+
+#if SIMPLE_OLED_BLANK_ON_CLEAR
+	SendCommand( OPC_DISPLAY_OFF );
+#endif
+
+	//----------------------------------------------------------------------
+	//	Set the display line offset back to the default value '0'.
+	//	That means beginn to display the display with the top line.
+	//
+	m_usLineOffset	= 0;
+	m_usScrollRow	= 0;
+
+	SendCommand( OPC_DISPLAY_LINE_OFFSET, 0 );
+
+#if SIMPLE_OLED_TEXT_SHADOW
+	memset( m_arusTextShadow, ' ', sizeof( m_arusTextShadow ) );
+#endif
+
+	//----------------------------------------------------------------------
+	//	clear all pages
+	//
+	for( uint8_t usPage = 0 ; usPage < SIMPLE_OLED_PAGES ; usPage++ )
+	{
+#if SIMPLE_OLED_FRAMEBUFFER
+		m_usWritePage	= usPage;
+		m_usWriteColumn	= 0;
+
+		for( uint8_t idx = 0 ; idx < DISPLAY_COLUMNS ; idx++ )
+		{
+			WriteData( 0x00 );
+		}
+#else
+		SendPosition( usPage, 0 );
+
+		for( uint8_t idx = 0 ; idx < DISPLAY_COLUMNS ; idx++ )
+		{
+			StreamData( 0x00 );
+		}
+
+		EndStream();
+#endif
+	}
+
+	EndData();
+
+#if SIMPLE_OLED_BLANK_ON_CLEAR
+	SendCommand( OPC_DISPLAY_ON );
+	EndStream();
+#endif
+
+	//----------------------------------------------------------------------
+	//	set the cursor to home position
+	//
+	SetCursor( 0, 0 );
+}
+
+
+//**************************************************************************
+//	ClearLine
+//--------------------------------------------------------------------------
+//	The function deletes the text line at the given cursor position and
+//	sets the cursor to the bginning of that line.
+//
+void SimpleDisplayClass::ClearLine( uint8_t usLineToClear )
+{
+	API_CALL( SIMPLE_OLED_API_CLEAR );
+
+	//------------------------------------------------------------------
+	//	at the end of the function the cursor will be positioned to
+	//	the beginning of the line that will be cleared
+	//
+	m_usTextLine	= usLineToClear;
+	m_usTextColumn	= 0;
+
+	//------------------------------------------------------------------
+	//	take care of the display line shift
+	//	and correct the line to clear accordingly
+	//
+	usLineToClear = DisplayLine( usLineToClear );
+
+#if SIMPLE_OLED_TEXT_SHADOW
+	memset( &m_arusTextShadow[ usLineToClear * TEXT_COLUMNS ], ' ', TEXT_COLUMNS );
+#endif
+
+	//------------------------------------------------------------------
+	//	clear all pages of the text line
+	//
+	uint8_t	usFirstPage = usLineToClear * PAGES_CHAR_HEIGHT;
+
+	for( uint8_t usPage = usFirstPage ; usPage < (usFirstPage + PAGES_CHAR_HEIGHT) ; usPage++ )
+	{
+#if SIMPLE_OLED_FRAMEBUFFER
+		//--------------------------------------------------------------
+		//	clear the page in the framebuffer
+		//
+		m_usWritePage	= usPage;
+		m_usWriteColumn	= 0;
+
+		for( uint8_t idx = 0 ; idx < DISPLAY_COLUMNS ; idx++ )
+		{
+			WriteData( 0x00 );
+		}
+#else
+		//--------------------------------------------------------------
+		//	set cursor to the first column of the page
+		//	and send the commands to position the cursor to the display
+		//
+		SendPosition( usPage, 0 );
+
+		//--------------------------------------------------------------
+		//	clear all columns of the page, the data is split into as few
+		//	transmissions as the transmit buffer allows
+		//
+		for( uint8_t idx = 0 ; idx < DISPLAY_COLUMNS ; idx++ )
+		{
+			StreamData( 0x00 );
+		}
+
+		EndStream();
+#endif
+	}
+
+	//------------------------------------------------------------------
+	//	the cursor is at the first text position of this line,
+	//	it is sent with the next character
+	//
+	m_bPositionValid = false;
+
+	EndData();
+}
+
+
+//**************************************************************************
+//	SetInverse
+//--------------------------------------------------------------------------
+//	This function inverses the display, means every OLED pixel that is 'on'
+//	will be turned 'off' and vice versa.
+//
+void SimpleDisplayClass::SetInverse( bool bInverse )
+{
+	API_CALL( SIMPLE_OLED_API_DISPLAY );
+
+#if SIMPLE_OLED_RECOVERY
+	m_bInverseDisplay = bInverse;
+#endif
+
+	if( bInverse )
+	{
+		SendCommand( OPC_MODE_INVERSE );
+	}
+	else
+	{
+		SendCommand( OPC_MODE_NORMAL );
+	}
+
+	EndStream();
+}
+
+
+//**************************************************************************
+//	Flip
+//--------------------------------------------------------------------------
+//	This function will turn the output on the display by 180 degree
+//	and clears the display.
+//	The two commands are sent together with the first cleared page.
+//
+void SimpleDisplayClass::Flip( bool bFlip )
+{
+	API_CALL( SIMPLE_OLED_API_DISPLAY );
+
+#if SIMPLE_OLED_RECOVERY
+	m_bFlip = bFlip;
+#endif
+
+	if( bFlip )
+	{
+		SendCommand( OPC_SEG_ROTATION_LEFT );
+		SendCommand( OPC_OUTPUT_SCAN_INVERSE );
+	}
+	else
+	{
+		SendCommand( OPC_SEG_ROTATION_RIGHT );
+		SendCommand( OPC_OUTPUT_SCAN_NORMAL );
+	}
+	
+	Clear();
+}
+
+
+//**************************************************************************
+//	SetPrintModeOverwriteSameLine
+//--------------------------------------------------------------------------
+//	This function sets the PrintMode to overwrite same line.
+//	Overwrite same line means:
+//	if the text output comes to the end of a line then continue with the
+//	output in the same line and overwrite an existing text.
+//
+void SimpleDisplayClass::SetPrintModeOverwriteSameLine( void )
+{
+	m_usPrintMode = PM_OVERWRITE_SAME_LINE;
+}
+
+
+//**************************************************************************
+//	SetPrintModeOverwriteNextLine
+//--------------------------------------------------------------------------
+//	This function sets the PrintMode to overwrite next line.
+//	Overwrite next line means:
+//	if the text output comes to the end of a line then continue with the
+//	output in the next line and perhaps overwrite an existing text.
+//	if it was the last line of the display then jumpt to the first line and
+//	continue the output there.
+//
+void SimpleDisplayClass::SetPrintModeOverwriteNextLine( void )
+{
+	m_usPrintMode = PM_OVERWRITE_NEXT_LINE;
+}
+
+
+//**************************************************************************
+//	SetPrintModeScrollLine
+//--------------------------------------------------------------------------
+//	This function sets the PrintMode to scroll line.
+//	Scroll line means:
+//	if the text output comes to the end of a line then continue with the
+//	output in the next line.
+//	If it was the last line of the display then scroll all lines one up
+//	discarding the first line, clear the last line and continue the output
+//	in the cleared last line.
+//
+void SimpleDisplayClass::SetPrintModeScrollLine( void )
+{
+	m_usPrintMode = PM_SCROLL_LINE;
+}
+
+
+//**************************************************************************
+//	SetScrollRegion
+//--------------------------------------------------------------------------
+//	This function sets the lines that are scrolled in the PrintMode scroll
+//	line, e.g. SetScrollRegion( 1, 6 ): the lines 1 to 6 scroll, the
+//	lines 0 and 7 stay as they are (title and status line).
+//	If the region covers all lines of the display (default) then the
+//	display is shifted with the display line offset (one command).
+//	Otherwise the lines of the region are rewritten, with the text shadow
+//	(SIMPLE_OLED_TEXT_SHADOW) only the characters that differ from the
+//	line below. Without text shadow the output continues in the first
+//	line of the region.
+//	The cursor never leaves a fixed line: a new line or a text that is
+//	longer than the line continues in the first column of the same line,
+//	the other fixed lines are not touched.
+//
+void SimpleDisplayClass::SetScrollRegion( uint8_t usFirstLine, uint8_t usLastLine )
+{
+	API_CALL( SIMPLE_OLED_API_DISPLAY );
+
+	if( (usFirstLine <= usLastLine) && (TEXT_LINES > usLastLine) )
+	{
+		m_usScrollFirst	= usFirstLine;
+		m_usScrollLast	= usLastLine;
+	}
+}
+
+
+//**************************************************************************
+//	SetSmoothScroll
+//--------------------------------------------------------------------------
+//	This function switches the smooth scroll for the PrintMode scroll line.
+//	bSmooth = true:
+//		the display is not shifted by a whole text line at once, Update()
+//		moves it one pixel row every usStepMillis milliseconds. Each step
+//		is a single command to the display (3 bytes).
+//		The new last line is cleared and written at once, it moves into
+//		view with the following steps. The display has no page that is
+//		not shown, so the rows of this line that are still shown at the
+//		top of the display change as well.
+//		If the next line is started before the steps of the last line are
+//		done, the display jumps to the end of the last line first.
+//	bSmooth = false:	(default)
+//		the display is shifted by a whole text line at once.
+//
+void SimpleDisplayClass::SetSmoothScroll( bool bSmooth, uint8_t usStepMillis )
+{
+	if( !bSmooth )
+	{
+		FinishScroll();
+	}
+
+	m_bSmoothScroll			= bSmooth;
+	m_usScrollStepMillis	= usStepMillis;
+}
+
+
+//**************************************************************************
+//	IsScrolling
+//--------------------------------------------------------------------------
+//	The function returns 'true' if the smooth scroll has not yet reached
+//	the actual line (see SetSmoothScroll()).
+//
+bool SimpleDisplayClass::IsScrolling( void )
+{
+	return( SCROLL_ROW( m_usLineOffset ) != m_usScrollRow );
+}
+
+
+//**************************************************************************
+//	SetDisplayColumnOffset
+//--------------------------------------------------------------------------
+//	With this function it is possible to adjust the display in left right
+//	direction in a small range.
+//
+//	Background:
+//	The OLED display that I used during development of this library has
+//	132 columns of OLED pixels. The font I use has 8 pixels per character.
+//	So 128 pixels are used for one text line. This leads to a left over
+//	of 4 pixels that can be used to adjust the text output on the display.
+//
+void SimpleDisplayClass::SetDisplayColumnOffset( uint8_t usOffset )
+{
+	API_CALL( SIMPLE_OLED_API_DISPLAY );
+
+	//----------------------------------------------------------------------
+	//	usOffset is unsigned, so DISPLAY_COLUMN_OFFSET_MIN (0) is always
+	//	reached
+	//
+	if( DISPLAY_COLUMN_OFFSET_MAX >= usOffset )
+	{
+#if SIMPLE_OLED_FRAMEBUFFER
+		//--------------------------------------------------------------
+		//	the offset is added to the column of every output, so the
+		//	content of the framebuffer moves by the difference
+		//
+		for( uint8_t usPage = 0 ; usPage < SIMPLE_OLED_PAGES ; usPage++ )
+		{
+			uint8_t	*pusPage = m_arusFrame[ usPage ];
+
+			if( usOffset > m_usColumnOffset )
+			{
+				uint8_t	usShift = usOffset - m_usColumnOffset;
+
+				memmove( &pusPage[ usShift ], pusPage, DISPLAY_COLUMNS - usShift );
+				memset( pusPage, 0x00, usShift );
+			}
+			else if( usOffset < m_usColumnOffset )
+			{
+				uint8_t	usShift = m_usColumnOffset - usOffset;
+
+				memmove( pusPage, &pusPage[ usShift ], DISPLAY_COLUMNS - usShift );
+				memset( &pusPage[ DISPLAY_COLUMNS - usShift ], 0x00, usShift );
+			}
+		}
+#endif
+
+		m_usColumnOffset	= usOffset;
+		m_bPositionValid	= false;
+
+		//--------------------------------------------------------------
+		//	the text already shown is not at the new character
+		//	positions: it is drawn again from the framebuffer or the
+		//	text shadow (without text shadow it stays where it is and
+		//	the next output uses the new offset)
+		//
+#if SIMPLE_OLED_FRAMEBUFFER || SIMPLE_OLED_TEXT_SHADOW
+		ReplayContent();
+#endif
+	}
+}
+
+
+//**************************************************************************
+//	Flush
+//--------------------------------------------------------------------------
+//	This function transmits all changes in the framebuffer to the display.
+//	For every page only the columns from the first to the last changed
+//	column are transmitted.
+//	Without framebuffer (SIMPLE_OLED_FRAMEBUFFER = 0) every output is
+//	transmitted immediately and this function does nothing.
+//
+void SimpleDisplayClass::Flush( void )
+{
+	API_CALL( SIMPLE_OLED_API_FLUSH );
+
+#if SIMPLE_OLED_FRAMEBUFFER
+	for( uint8_t usPage = 0 ; usPage < SIMPLE_OLED_PAGES ; usPage++ )
+	{
+		uint8_t	usFirst	= m_arusDirtyFirst[ usPage ];
+		uint8_t	usLast	= m_arusDirtyLast[ usPage ];
+
+		if( usFirst <= usLast )
+		{
+			SendPosition( usPage, usFirst );
+
+			for( uint8_t usColumn = usFirst ; usColumn <= usLast ; usColumn++ )
+			{
+				StreamData( m_arusFrame[ usPage ][ usColumn ] );
+			}
+
+			EndStream();
+
+			m_arusDirtyFirst[ usPage ]	= DIRTY_NONE_FIRST;
+			m_arusDirtyLast[ usPage ]	= DIRTY_NONE_LAST;
+		}
+	}
+#endif
+}
+
+
+//**************************************************************************
+//	SetAutoFlush
+//--------------------------------------------------------------------------
+//	With framebuffer (SIMPLE_OLED_FRAMEBUFFER = 1) the output goes into
+//	the framebuffer first.
+//	bAutoFlush = true:	(default)
+//		Print, PrintLn, Clear, ClearLine and the graphic functions call
+//		Flush() when they are done.
+//	bAutoFlush = false:
+//		the changes are collected until Flush() is called. So many small
+//		changes will be transmitted together.
+//
+void SimpleDisplayClass::SetAutoFlush( bool bAutoFlush )
+{
+#if SIMPLE_OLED_FRAMEBUFFER
+	m_bAutoFlush = bAutoFlush;
+#else
+	(void)bAutoFlush;
+#endif
+}
+
+
+//**************************************************************************
+//	SetRefreshRate
+//--------------------------------------------------------------------------
+//	This function needs the framebuffer (SIMPLE_OLED_FRAMEBUFFER = 1),
+//	it limits the transmissions of the framebuffer to usFramesPerSecond
+//	per second.
+//	usFramesPerSecond > 0:
+//		all output only changes the framebuffer. Update() transmits the
+//		changes when the time of the next frame has come, so intermediate
+//		states (e.g. a value that is printed a hundred times per second)
+//		never go to the display. Flush() transmits the changes at once,
+//		e.g. for urgent content.
+//		Commands like SetInverse(), Flip() or the display line offset of
+//		the PrintMode scroll line are still sent at once.
+//	usFramesPerSecond = 0:	(default)
+//		the changes are transmitted as set by SetAutoFlush(), changes
+//		that are still in the framebuffer are transmitted now.
+//	Without framebuffer (the default) every output is transmitted
+//	immediately and this function does nothing.
+//
+void SimpleDisplayClass::SetRefreshRate( uint8_t usFramesPerSecond )
+{
+	API_CALL( SIMPLE_OLED_API_FLUSH );
+
+#if SIMPLE_OLED_FRAMEBUFFER
+	if( 0 == usFramesPerSecond )
+	{
+		m_uiFrameMillis = 0;
+
+		Flush();
+	}
+	else
+	{
+		m_uiFrameMillis	= 1000 / usFramesPerSecond;
+		m_uiFrameTime	= (uint16_t)millis() - m_uiFrameMillis;
+	}
+#else
+	(void)usFramesPerSecond;
+#endif
+}
+
+
+//**************************************************************************
+//	SetAsync
+//--------------------------------------------------------------------------
+//	With transmit queue (SIMPLE_OLED_TX_QUEUE_SIZE > 0) this function
+//	switches the asynchronous mode on or off.
+//	bAsync = true:
+//		all functions put their transmissions into the transmit queue and
+//		return at once. The transmissions are sent by Update(), which
+//		must be called regularly (e.g. from loop()). If the queue is full
+//		then the function waits until enough transmissions are sent.
+//	bAsync = false:	(default)
+//		every transmission is sent before the function returns.
+//		Transmissions that are still in the queue are sent first.
+//
+void SimpleDisplayClass::SetAsync( bool bAsync )
+{
+	API_CALL( SIMPLE_OLED_API_UPDATE );
+
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+	if( !bAsync )
+	{
+		WaitIdle();
+	}
+
+	m_bAsync = bAsync;
+#else
+	(void)bAsync;
+#endif
+}
+
+
+//**************************************************************************
+//	Update
+//--------------------------------------------------------------------------
+//	This function sends up to usMaxTransmissions transmissions from the
+//	transmit queue to the display.
+//	With smooth scroll the display is moved one pixel row if the time for
+//	the next step has come (see SetSmoothScroll()).
+//	With refresh rate the changes in the framebuffer are transmitted if
+//	the time for the next frame has come (see SetRefreshRate()).
+//	The function returns 'true' if there are still transmissions in the
+//	queue.
+//
+bool SimpleDisplayClass::Update( uint8_t usMaxTransmissions )
+{
+	API_CALL( SIMPLE_OLED_API_UPDATE );
+
+#if SIMPLE_OLED_RECOVERY
+	CheckLink();
+#endif
+
+	if( m_bSmoothScroll && IsScrolling() )
+	{
+		uint16_t	uiNow = (uint16_t)millis();
+
+		if( m_usScrollStepMillis <= (uint16_t)(uiNow - m_uiScrollStepTime) )
+		{
+			m_uiScrollStepTime	= uiNow;
+			m_usScrollRow		= (m_usScrollRow + 1) & DISPLAY_LINE_OFFSET_MAX;
+
+			SendCommand( OPC_DISPLAY_LINE_OFFSET, m_usScrollRow );
+			EndStream();
+		}
+	}
+
+#if SIMPLE_OLED_FRAMEBUFFER
+	//----------------------------------------------------------------------
+	//	with refresh rate the changes in the framebuffer are transmitted
+	//	at most once per frame
+	//
+	if( 0 < m_uiFrameMillis )
+	{
+		uint16_t	uiNow = (uint16_t)millis();
+
+		if( (m_uiFrameMillis <= (uint16_t)(uiNow - m_uiFrameTime)) && IsFrameDirty() )
+		{
+			m_uiFrameTime = uiNow;
+
+			Flush();
+		}
+	}
+#endif
+
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+	while( (0 < usMaxTransmissions) && (0 < m_uiQueueUsed) )
+	{
+		SendQueued();
+		usMaxTransmissions--;
+	}
+
+	return( 0 < m_uiQueueUsed );
+#else
+	(void)usMaxTransmissions;
+
+	return( false );
+#endif
+}
+
+
+//**************************************************************************
+//	WaitIdle
+//--------------------------------------------------------------------------
+//	This function sends all transmissions of the transmit queue before it
+//	returns.
+//
+void SimpleDisplayClass::WaitIdle( void )
+{
+	API_CALL( SIMPLE_OLED_API_UPDATE );
+
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+	while( 0 < m_uiQueueUsed )
+	{
+		SendQueued();
+	}
+#endif
+}
+
+
+//**************************************************************************
+//	QueueHighWater
+//--------------------------------------------------------------------------
+//	The function returns the maximum number of bytes that were used in
+//	the transmit queue since Init().
+//	With this value the size of the queue (SIMPLE_OLED_TX_QUEUE_SIZE) can
+//	be adjusted to the needs of the sketch.
+//
+uint16_t SimpleDisplayClass::QueueHighWater( void )
+{
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+	return( m_uiQueueHighWater );
+#else
+	return( 0 );
+#endif
+}
+
+
+//**************************************************************************
+//	IsIdle
+//--------------------------------------------------------------------------
+//	The function returns 'true' if there are no transmissions in the
+//	transmit queue. Unlike Update() it does nothing else, so it can be
+//	used to check the queue (e.g. by SimpleDisplayManager).
+//
+bool SimpleDisplayClass::IsIdle( void )
+{
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+	return( 0 == m_uiQueueUsed );
+#else
+	return( true );
+#endif
+}
+
+
+//**************************************************************************
+//	GetStats
+//--------------------------------------------------------------------------
+//	With statistics (SIMPLE_OLED_STATS = 1) this function copies the
+//	counters since the last ResetStats() to *ptStats:
+//	transmissions, their bytes, the address commands among them, failed
+//	transmissions, the time from start to end of all transmissions and
+//	the longest call of each group of public functions (in µs).
+//	In asynchronous mode the transmissions are counted when Update()
+//	sends them.
+//	Without statistics all values are 0.
+//
+void SimpleDisplayClass::GetStats( SimpleOledStats *ptStats )
+{
+#if SIMPLE_OLED_STATS
+	memcpy( ptStats, &m_tStats, sizeof( SimpleOledStats ) );
+#else
+	memset( ptStats, 0, sizeof( SimpleOledStats ) );
+#endif
+}
+
+
+//**************************************************************************
+//	ResetStats
+//--------------------------------------------------------------------------
+//	This function sets all counters of the statistics to 0.
+//
+void SimpleDisplayClass::ResetStats( void )
+{
+#if SIMPLE_OLED_STATS
+	memset( &m_tStats, 0, sizeof( m_tStats ) );
+#endif
+}
+
+
+//**************************************************************************
+//	DumpTrace
+//--------------------------------------------------------------------------
+//	With trace (SIMPLE_OLED_TRACE_SIZE > 0) this function writes the
+//	records of the trace to clOutput, e.g. Serial, the oldest record
+//	first. Each record is one line of 8 hex digits: event, value and the
+//	time since the previous record in µs (see SimpleOledTraceRecord),
+//	framed by a line with the number of records and an end line:
+//
+//		SIMPLE_OLED_TRACE 3
+//		01010000
+//		030000A2
+//		04120B3C
+//		SIMPLE_OLED_TRACE_END
+//
+//	The records stay in the trace (see ClearTrace()). The output must not
+//	be the display itself. The program extras/host/trace_decode turns the
+//	output into a timeline and histograms of the durations.
+//	Without trace only the frame with 0 records is written.
+//
+void SimpleDisplayClass::DumpTrace( ::Print &clOutput )
+{
+	clOutput.print( F( "SIMPLE_OLED_TRACE " ) );
+
+#if SIMPLE_OLED_TRACE_SIZE
+	uint16_t	uiIdx;
+	uint16_t	uiRecords	= m_uiTraceRecords;
+	uint32_t	ulRecord;
+	uint8_t		usDigit;
+	uint8_t		usNibble;
+	char		arcRecord[ 9 ];
+
+	clOutput.println( uiRecords );
+
+	//------------------------------------------------------------------
+	//	the oldest record follows the newest one in the ring
+	//
+	uiIdx = (SIMPLE_OLED_TRACE_SIZE == uiRecords) ? m_uiTraceNext : 0;
+
+	while( 0 < uiRecords-- )
+	{
+		ulRecord =	((uint32_t)m_artTrace[ uiIdx ].usEvent << 24)
+				|	((uint32_t)m_artTrace[ uiIdx ].usValue << 16)
+				|	m_artTrace[ uiIdx ].uiDeltaMicros;
+
+		for( usDigit = 0 ; usDigit < 8 ; usDigit++ )
+		{
+			usNibble				= (uint8_t)((ulRecord >> (28 - 4 * usDigit)) & 0x0F);
+			arcRecord[ usDigit ]	= (char)((10 > usNibble) ? ('0' + usNibble) : ('A' - 10 + usNibble));
+		}
+
+		arcRecord[ 8 ] = '\0';
+		clOutput.println( arcRecord );
+
+		if( SIMPLE_OLED_TRACE_SIZE <= ++uiIdx )
+		{
+			uiIdx = 0;
+		}
+	}
+#else
+	clOutput.println( 0 );
+#endif
+
+	clOutput.println( F( "SIMPLE_OLED_TRACE_END" ) );
+}
+
+
+//**************************************************************************
+//	ClearTrace
+//--------------------------------------------------------------------------
+//	This function removes all records from the trace, the next record
+//	holds the time since this call.
+//
+void SimpleDisplayClass::ClearTrace( void )
+{
+#if SIMPLE_OLED_TRACE_SIZE
+	m_uiTraceNext		= 0;
+	m_uiTraceRecords	= 0;
+	m_uiTraceBytes		= 0;
+	m_ulTraceTime		= micros();
+#endif
+}
+
+
+//**************************************************************************
+//	SetBusClock
+//--------------------------------------------------------------------------
+//	This function sets the clock of the bus in Hz, e.g.
+//	SIMPLE_OLED_CLOCK_FAST (400 kHz). It can be called before Init(),
+//	the clock is kept when the bus is started again.
+//
+void SimpleDisplayClass::SetBusClock( uint32_t ulClock )
+{
+	m_clTransport.SetClock( ulClock );
+}
+
+
+//**************************************************************************
+//	AutoTuneClock
+//--------------------------------------------------------------------------
+//	This function looks for the fastest clock of the I²C bus that works
+//	with the display, call it after Init(). The clocks 100 kHz, 400 kHz
+//	and 1 MHz up to ulMaxClock are tried one after the other. Each clock
+//	is checked with some probes and status reads (see CheckClock()), the
+//	first clock that fails ends the search. The bus is cleared after a
+//	failed check.
+//	The function returns the selected clock. The clock of the SPI bus is
+//	not changed because the SPI bus has no acknowledge to check it.
+//
+uint32_t SimpleDisplayClass::AutoTuneClock( uint32_t ulMaxClock )
+{
+	API_CALL( SIMPLE_OLED_API_INIT );
+
+#if SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_SPI
+	(void)ulMaxClock;
+#else
+	uint32_t	ulGood = m_clTransport.GetClock();
+	uint32_t	ulClock;
+
+	if( 0 == ulGood )
+	{
+		ulGood = SIMPLE_OLED_CLOCK_STANDARD;
+	}
+
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+	WaitIdle();
+#endif
+
+	for( uint8_t idx = 0 ; idx < TUNE_CLOCKS ; idx++ )
+	{
+		ulClock = pgm_read_dword( &g_arulTuneClock[ idx ] );
+
+		if( ulMaxClock < ulClock )
+		{
+			break;
+		}
+
+		m_clTransport.SetClock( ulClock );
+
+		if( !CheckClock() )
+		{
+			//--------------------------------------------------------------
+			//	back to the last good clock, a slave may still hold the
+			//	bus after the failed check
+			//
+			m_clTransport.SetClock( ulGood );
+			m_clTransport.ClearBus();
+
+			return( ulGood );
+		}
+
+		ulGood = ulClock;
+	}
+
+	m_clTransport.SetClock( ulGood );
+#endif
+
+	return( m_clTransport.GetClock() );
+}
+
+
+//**************************************************************************
+//	SetRecovery
+//--------------------------------------------------------------------------
+//	This function sets how often a failed transmission is repeated before
+//	the display is offline and how long the repetitions of one function
+//	call may take in ms (see SIMPLE_OLED_RECOVERY).
+//	Without recovery this function does nothing.
+//
+void SimpleDisplayClass::SetRecovery( uint8_t usRetries, uint8_t usMaxBlockMillis )
+{
+#if SIMPLE_OLED_RECOVERY
+	m_usRetries			= usRetries;
+	m_usMaxBlockMillis	= usMaxBlockMillis;
+#else
+	(void)usRetries;
+	(void)usMaxBlockMillis;
+#endif
+}
+
+
+//**************************************************************************
+//	IsOnline
+//--------------------------------------------------------------------------
+//	The function returns 'false' while the display does not answer after
+//	failed transmissions. Update() looks for the display and transmits
+//	the content again when it answers (see SIMPLE_OLED_RECOVERY).
+//	Without recovery the function always returns 'true'.
+//
+bool SimpleDisplayClass::IsOnline( void )
+{
+#if SIMPLE_OLED_RECOVERY
+	return( LINK_LOST != m_usLink );
+#else
+	return( true );
+#endif
+}
+
+
+//**************************************************************************
+//	RecoveryCount
+//--------------------------------------------------------------------------
+//	The function returns how often the display was initialized again
+//	after it was offline or reset.
+//
+uint16_t SimpleDisplayClass::RecoveryCount( void )
+{
+#if SIMPLE_OLED_RECOVERY
+	return( m_uiRecoveries );
+#else
+	return( 0 );
+#endif
+}
+
+
+#if SIMPLE_OLED_TRACE_SIZE
+//**************************************************************************
+//	Trace (private)
+//--------------------------------------------------------------------------
+//	This function adds a record with the time since the previous record
+//	to the trace, when the trace is full the oldest record is overwritten.
+//	A time of more than 65535 µs needs an extra record
+//	SIMPLE_OLED_TRACE_GAP with the full milliseconds.
+//
+void SimpleDisplayClass::Trace( uint8_t usEvent, uint8_t usValue )
+{
+	uint32_t	ulNow	= micros();
+	uint32_t	ulDelta	= ulNow - m_ulTraceTime;
+
+	m_ulTraceTime = ulNow;
+
+	if( 0xFFFF < ulDelta )
+	{
+		m_artTrace[ m_uiTraceNext ].usEvent			= SIMPLE_OLED_TRACE_GAP;
+		m_artTrace[ m_uiTraceNext ].usValue			= 0;
+		m_artTrace[ m_uiTraceNext ].uiDeltaMicros	= (uint16_t)((0xFFFF < (ulDelta / 1000)) ? 0xFFFF : (ulDelta / 1000));
+
+		ulDelta %= 1000;
+
+		if( SIMPLE_OLED_TRACE_SIZE <= ++m_uiTraceNext )
+		{
+			m_uiTraceNext = 0;
+		}
+
+		if( SIMPLE_OLED_TRACE_SIZE > m_uiTraceRecords )
+		{
+			m_uiTraceRecords++;
+		}
+	}
+
+	m_artTrace[ m_uiTraceNext ].usEvent			= usEvent;
+	m_artTrace[ m_uiTraceNext ].usValue			= usValue;
+	m_artTrace[ m_uiTraceNext ].uiDeltaMicros	= (uint16_t)ulDelta;
+
+	if( SIMPLE_OLED_TRACE_SIZE <= ++m_uiTraceNext )
+	{
+		m_uiTraceNext = 0;
+	}
+
+	if( SIMPLE_OLED_TRACE_SIZE > m_uiTraceRecords )
+	{
+		m_uiTraceRecords++;
+	}
+}
+#endif
+
+
+//**************************************************************************
+//	SendCommand (private)
+//--------------------------------------------------------------------------
+//	This function adds a one byte command to the command stream
+//	(see StreamCommand()).
+//
+void SimpleDisplayClass::SendCommand( uint8_t usOpCode )
+{
+	StreamCommand( usOpCode );
+}
+
+
+//**************************************************************************
+//	SendCommand (private)
+//--------------------------------------------------------------------------
+//	This function adds a two byte command (command code and parameter)
+//	to the command stream (see StreamCommand()).
+//
+void SimpleDisplayClass::SendCommand( uint8_t usOpCode, uint8_t usParameter )
+{
+	StreamCommand( usOpCode );
+	StreamCommand( usParameter );
+}
+
+
+//**************************************************************************
+//	WriteGlyph (private)
+//--------------------------------------------------------------------------
+//	This function will write the bitmap of the given character into the
+//	actual data transmission (see WriteData()) without closing it.
+//	So consecutive characters of the same line will be collected and sent
+//	to the display together.
+//	A new line character ('\n') or reaching the end of the line will close
+//	the data transmission because the cursor has to be repositioned.
+//	Characters that are higher than one page are collected in the glyph
+//	run and sent page by page (see WriteGlyphRun()).
+//
+void SimpleDisplayClass::WriteGlyph( uint8_t usCharIdx )
+{
+	if( '\n' == usCharIdx )
+	{
+		NextLine( true );
+	}
+	else if( (gc_tFont.usFirstChar <= usCharIdx) && (gc_tFont.usLastChar >= usCharIdx) )
+	{
+		uint8_t	usCell = m_bInverse ? (usCharIdx | SHADOW_INVERSE) : usCharIdx;
+
+		//--------------------------------------------------------------
+		//	if we reached the end of the line then depending of the
+		//	PrintMode continue in the 'next line'
+		//
+		if( TEXT_COLUMNS <= m_usTextColumn )
+		{
+			NextLine( false );
+		}
+
+#if SIMPLE_OLED_TEXT_SHADOW
+		//--------------------------------------------------------------
+		//	if the display already shows this character at the cursor
+		//	position then there is no need to transmit it again.
+		//	But the column of the display is no longer in sync with
+		//	the cursor, so the next character that is transmitted
+		//	needs a new positioning.
+		//
+		uint8_t	*pusShadow	= &m_arusTextShadow[ (DisplayLine( m_usTextLine ) * TEXT_COLUMNS) + m_usTextColumn ];
+
+		if( usCell == *pusShadow )
+		{
+			m_bPositionValid = false;
+			m_usTextColumn++;
+
+			return;
+		}
+
+		*pusShadow = usCell;
+#endif
+
+#if 1 < SIMPLE_OLED_CELL_PAGES
+		//--------------------------------------------------------------
+		//	add the character to the glyph run, a character that does
+		//	not follow the run directly starts a new run
+		//
+		if(		(0 < m_usRunLength)
+			&&	((m_usRunLine != m_usTextLine) || ((m_usRunColumn + m_usRunLength) != m_usTextColumn)) )
+		{
+			WriteGlyphRun();
+		}
+
+		if( 0 == m_usRunLength )
+		{
+			m_usRunLine		= m_usTextLine;
+			m_usRunColumn	= m_usTextColumn;
+		}
+
+		m_arusGlyphRun[ m_usRunLength++ ] = usCell;
+#else
+		//--------------------------------------------------------------
+		//	position the display to the start of the character,
+		//	take care of the display line shift
+		//
+		if( !m_bPositionValid )
+		{
+			SetWritePosition(	DisplayLine( m_usTextLine ),
+								(m_usTextColumn * PIXELS_CHAR_WIDTH) + m_usColumnOffset );
+		}
+
+		WriteGlyphPage( usCell, 0 );
+#endif
+
+		//--------------------------------------------------------------
+		//	one character printed, so move cursor
+		//
+		m_usTextColumn++;
+	}
+}
+
+
+//**************************************************************************
+//	WriteGlyphPage (private)
+//--------------------------------------------------------------------------
+//	This function writes one page of the bitmap of a character at the
+//	actual write position (see WriteData()).
+//	usCell is the character code, bit 7 set for inverse font.
+//	usCharPage is the page within the character (0 = top page).
+//	With SIMPLE_OLED_FONT_HEIGHT_SCALE > 1 the bits of each column are
+//	spread with a lookup table, with SIMPLE_OLED_FONT_SCALE > 1 each
+//	column is repeated.
+//
+void SimpleDisplayClass::WriteGlyphPage( uint8_t usCell, uint8_t usCharPage )
+{
+	uint16_t		uiHelper;
+	const uint8_t *	pusActualColumn;
+	uint8_t			usLetterColumn;
+
+	//----------------------------------------------------------------------
+	//	this is a printable character, so calculate the pointer
+	//	into the font array to that position where the bitmap of
+	//	this page of the character starts
+	//
+	uiHelper	= (usCell & ~SHADOW_INVERSE) - gc_tFont.usFirstChar;
+	uiHelper   *= gc_usGlyphBytes;
+	uiHelper   += (usCharPage / gc_usFontHeightScale) * gc_tFont.usWidth;
+
+	pusActualColumn = &FONT_GLYPHS[ 0 ] + uiHelper;
+
+	//----------------------------------------------------------------------
+	//	add the bitmap of the character to the data transmission
+	//
+	for( uint8_t idx = 0 ; idx < gc_tFont.usWidth ; idx++ )
+	{
+		usLetterColumn = pgm_read_byte( pusActualColumn );
+		pusActualColumn++;
+
+#if 1 < SIMPLE_OLED_FONT_HEIGHT_SCALE
+		//------------------------------------------------------------------
+		//	scale the column: spread the bits with the lookup table
+		//	and take the 8 bits for this page, the low nibble gives the
+		//	lower 4 * SIMPLE_OLED_FONT_HEIGHT_SCALE bits of the column
+		//
+		uint32_t	ulLow	= READ_SPREAD_BITS( usLetterColumn & 0x0F );
+		uint32_t	ulHigh	= READ_SPREAD_BITS( usLetterColumn >> 4 );
+		uint8_t		usBit	= (usCharPage % SIMPLE_OLED_FONT_HEIGHT_SCALE) * PIXELS_PAGE_HEIGHT;
+
+		if( (4 * SIMPLE_OLED_FONT_HEIGHT_SCALE) > usBit )
+		{
+			usLetterColumn = (uint8_t)((ulLow >> usBit) | (ulHigh << ((4 * SIMPLE_OLED_FONT_HEIGHT_SCALE) - usBit)));
+		}
+		else
+		{
+			usLetterColumn = (uint8_t)(ulHigh >> (usBit - (4 * SIMPLE_OLED_FONT_HEIGHT_SCALE)));
+		}
+#endif
+
+		if( usCell & SHADOW_INVERSE )
+		{
+			usLetterColumn = ~usLetterColumn;
+		}
+
+#if 1 < SIMPLE_OLED_FONT_SCALE
+		for( uint8_t usRepeat = 0 ; usRepeat < SIMPLE_OLED_FONT_SCALE ; usRepeat++ )
+		{
+			WriteData( usLetterColumn );
+		}
+#else
+		WriteData( usLetterColumn );
+#endif
+	}
+}
+
+
+#if 1 < SIMPLE_OLED_CELL_PAGES
+//**************************************************************************
+//	WriteGlyphRun (private)
+//--------------------------------------------------------------------------
+//	This function writes the characters of the glyph run to the display.
+//	The characters are higher than one page, so first the top page of all
+//	characters is written, then the next page, and so on. That needs one
+//	positioning per page instead of one per page and character.
+//
+void SimpleDisplayClass::WriteGlyphRun( void )
+{
+	uint8_t	usPage		= DisplayLine( m_usRunLine ) * PAGES_CHAR_HEIGHT;
+	uint8_t	usColumn	= (m_usRunColumn * PIXELS_CHAR_WIDTH) + m_usColumnOffset;
+
+	for( uint8_t usCharPage = 0 ; usCharPage < PAGES_CHAR_HEIGHT ; usCharPage++ )
+	{
+		SetWritePosition( usPage + usCharPage, usColumn );
+
+		for( uint8_t idx = 0 ; idx < m_usRunLength ; idx++ )
+		{
+			WriteGlyphPage( m_arusGlyphRun[ idx ], usCharPage );
+		}
+	}
+
+	m_usRunLength		= 0;
+	m_bPositionValid	= false;
+}
+#endif
+
+
+//**************************************************************************
+//	WriteData (private)
+//--------------------------------------------------------------------------
+//	This function writes one byte of display data at the actual write
+//	position and moves the write position to the next column.
+//	Without framebuffer the byte is added to the actual data transmission
+//	(see StreamData()), otherwise it is stored in the framebuffer.
+//
+void SimpleDisplayClass::WriteData( uint8_t usData )
+{
+#if SIMPLE_OLED_FRAMEBUFFER
+	if( DISPLAY_COLUMNS > m_usWriteColumn )
+	{
+		uint8_t	*pusFrame = &m_arusFrame[ m_usWritePage ][ m_usWriteColumn ];
+
+		if( usData != *pusFrame )
+		{
+			*pusFrame = usData;
+
+			if( m_arusDirtyFirst[ m_usWritePage ] > m_usWriteColumn )
+			{
+				m_arusDirtyFirst[ m_usWritePage ] = m_usWriteColumn;
+			}
+
+			if( m_arusDirtyLast[ m_usWritePage ] < m_usWriteColumn )
+			{
+				m_arusDirtyLast[ m_usWritePage ] = m_usWriteColumn;
+			}
+		}
+
+		m_usWriteColumn++;
+	}
+#else
+	StreamData( usData );
+#endif
+}
+
+
+//**************************************************************************
+//	EndData (private)
+//--------------------------------------------------------------------------
+//	This function finishes the output of display data.
+//	A pending glyph run is written first (see WriteGlyphRun()).
+//	With framebuffer the framebuffer is transmitted if auto flush is
+//	active and no refresh rate is set (see SetRefreshRate()).
+//	Then the open transmission is sent to the display.
+//
+void SimpleDisplayClass::EndData( void )
+{
+#if 1 < SIMPLE_OLED_CELL_PAGES
+	if( 0 < m_usRunLength )
+	{
+		WriteGlyphRun();
+	}
+#endif
+
+#if SIMPLE_OLED_FRAMEBUFFER
+	if( m_bAutoFlush && (0 == m_uiFrameMillis) )
+	{
+		Flush();
+	}
+#endif
+
+#if SIMPLE_OLED_READ_BACK
+	m_usReadBytes = 0;
+#endif
+
+	EndStream();
+}
+
+
+//**************************************************************************
+//	SetWritePosition (private)
+//--------------------------------------------------------------------------
+//	This function sets the position (page and column) of the display RAM
+//	where the next display data will be written to.
+//	Without framebuffer the position is added to the command stream and
+//	goes out together with the following data.
+//
+void SimpleDisplayClass::SetWritePosition( uint8_t usPage, uint8_t usColumn )
+{
+#if SIMPLE_OLED_FRAMEBUFFER
+	m_usWritePage	= usPage;
+	m_usWriteColumn	= usColumn;
+#else
+	SendPosition( usPage, usColumn );
+#endif
+
+	m_bPositionValid = true;
+}
+
+
+//**************************************************************************
+//	SendPosition (private)
+//--------------------------------------------------------------------------
+//	This function adds the commands to set page and column address of
+//	the display to the command stream.
+//	The display increments its column address with every data byte, so
+//	very often it is already at the right position. Only the commands
+//	for the parts of the address that differ are sent.
+//
+void SimpleDisplayClass::SendPosition( uint8_t usPage, uint8_t usColumn )
+{
+	if( usPage != m_usRamPage )
+	{
+		StreamCommand( OPC_PAGE_ADDRESS | (usPage & MASK_PAGE_ADDRESS) );
+
+#if SIMPLE_OLED_STATS
+		m_tStats.ulAddressBytes++;
+#endif
+
+		m_usRamPage = usPage;
+	}
+
+	if( usColumn != m_usRamColumn )
+	{
+		uint8_t	usChanged = usColumn ^ m_usRamColumn;
+
+		if( RAM_ADDRESS_UNKNOWN == m_usRamColumn )
+		{
+			usChanged = MASK_COLUMN_ADDRESS_LOW | MASK_COLUMN_ADDRESS_HIGH;
+		}
+
+		if( usChanged & MASK_COLUMN_ADDRESS_LOW )
+		{
+			StreamCommand( OPC_COLUMN_ADDRESS_LOW | (usColumn & MASK_COLUMN_ADDRESS_LOW) );
+
+#if SIMPLE_OLED_STATS
+			m_tStats.ulAddressBytes++;
+#endif
+		}
+
+		if( usChanged & MASK_COLUMN_ADDRESS_HIGH )
+		{
+			StreamCommand( OPC_COLUMN_ADDRESS_HIGH | ((usColumn & MASK_COLUMN_ADDRESS_HIGH) >> 4) );
+
+#if SIMPLE_OLED_STATS
+			m_tStats.ulAddressBytes++;
+#endif
+		}
+
+		m_usRamColumn = usColumn;
+	}
+}
+
+
+//**************************************************************************
+//	StreamCommand (private)
+//--------------------------------------------------------------------------
+//	This function adds one command byte (command code or parameter) to
+//	the command stream.
+//	All commands of the stream and optionally a following block of data
+//	(see StreamData()) are sent in one transmission:
+//
+//		commands only:
+//			PREFIX_LAST_COMMAND, cmd, cmd, ... cmd
+//		commands and data:
+//			PREFIX_NEXT_COMMAND, cmd, ... PREFIX_NEXT_COMMAND, cmd,
+//			PREFIX_DATA, data, ... data
+//
+//	Which form is used is known only when the data starts or the stream
+//	ends (EndStream()), so the commands are collected until then.
+//	Once the data block has started a command needs a new transmission.
+//
+void SimpleDisplayClass::StreamCommand( uint8_t usCommand )
+{
+	if( m_bStreamData || (SIMPLE_OLED_STREAM_COMMANDS <= m_usStreamCommands) )
+	{
+		EndStream();
+	}
+
+	m_arusStreamCommand[ m_usStreamCommands++ ] = usCommand;
+}
+
+
+//**************************************************************************
+//	StreamData (private)
+//--------------------------------------------------------------------------
+//	This function adds one byte of display data to the actual
+//	transmission. Commands in the command stream are sent in front of
+//	the data in the same transmission. If there is no open transmission
+//	then a new one will be started. If the transmission buffer is full
+//	then the transmission will be sent and a new one will be started.
+//
+void SimpleDisplayClass::StreamData( uint8_t usData )
+{
+	if( m_bStreamData && (I2C_BUFFER_SIZE <= m_uiStreamBytes) )
+	{
+		EndStream();
+	}
+
+	if( !m_bStreamData )
+	{
+		//--------------------------------------------------------------
+		//	the commands, the data prefix and at least one data byte
+		//	must fit into the buffer, otherwise the commands are sent
+		//	in a transmission of their own
+		//
+		if( I2C_BUFFER_SIZE < ((m_usStreamCommands * STREAM_COMMAND_BYTES) + STREAM_DATA_MIN_BYTES) )
+		{
+			EndStream();
+		}
+
+		BusBegin();
+
+		for( uint8_t idx = 0 ; idx < m_usStreamCommands ; idx++ )
+		{
+			BusWrite( PREFIX_NEXT_COMMAND );
+			BusWrite( m_arusStreamCommand[ idx ] );
+		}
+
+		BusWrite( PREFIX_DATA );
+
+		m_uiStreamBytes		= (m_usStreamCommands * STREAM_COMMAND_BYTES) + 1;
+		m_usStreamCommands	= 0;
+		m_bStreamData		= true;
+	}
+
+	BusWrite( usData );
+	m_uiStreamBytes++;
+
+	//------------------------------------------------------------------
+	//	the display moves to the next column, behind the last column
+	//	the address is no longer known
+	//
+	if( RAM_ADDRESS_UNKNOWN != m_usRamColumn )
+	{
+		m_usRamColumn++;
+
+		if( DISPLAY_COLUMNS <= m_usRamColumn )
+		{
+			m_usRamColumn = RAM_ADDRESS_UNKNOWN;
+		}
+	}
+}
+
+
+//**************************************************************************
+//	EndStream (private)
+//--------------------------------------------------------------------------
+//	This function sends the open transmission (commands or data) to the
+//	display.
+//
+void SimpleDisplayClass::EndStream( void )
+{
+	if( m_bStreamData )
+	{
+		BusEnd();
+
+		m_uiStreamBytes	= 0;
+		m_bStreamData	= false;
+	}
+	else if( 0 < m_usStreamCommands )
+	{
+		BusBegin();
+		BusWrite( PREFIX_LAST_COMMAND );
+		BusWrite( m_arusStreamCommand, m_usStreamCommands );
+		BusEnd();
+
+		m_usStreamCommands = 0;
+	}
+}
+
+
+//**************************************************************************
+//	BusBegin (private)
+//--------------------------------------------------------------------------
+//	This function starts a new transmission to the display.
+//	In asynchronous mode the transmission is stored in the transmit queue.
+//	If there is not enough space in the queue for a complete transmission
+//	then queued transmissions are sent until there is enough space.
+//
+void SimpleDisplayClass::BusBegin( void )
+{
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+	if( m_bAsync )
+	{
+		while( (SIMPLE_OLED_TX_QUEUE_SIZE - m_uiQueueUsed) < (I2C_BUFFER_SIZE + 1) )
+		{
+			SendQueued();
+		}
+
+		m_uiQueueRecord	= m_uiQueueTail;
+		m_uiQueueWrite	= QueueNext( m_uiQueueTail );
+		m_uiRecordBytes	= 0;
+
+		return;
+	}
+#endif
+
+	TransportBegin();
+}
+
+
+//**************************************************************************
+//	BusWrite (private)
+//--------------------------------------------------------------------------
+//	This function adds one byte to the actual transmission.
+//
+void SimpleDisplayClass::BusWrite( uint8_t usData )
+{
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+	if( m_bAsync )
+	{
+		m_arusQueue[ m_uiQueueWrite ] = usData;
+		m_uiQueueWrite = QueueNext( m_uiQueueWrite );
+		m_uiRecordBytes++;
+
+		return;
+	}
+#endif
+
+#if SIMPLE_OLED_STATS
+	m_tStats.ulPayloadBytes++;
+#endif
+
+#if SIMPLE_OLED_TRACE_SIZE
+	m_uiTraceBytes++;
+#endif
+
+	TransportWrite( usData );
+}
+
+
+//**************************************************************************
+//	BusWrite (private)
+//--------------------------------------------------------------------------
+//	This function adds some bytes to the actual transmission.
+//
+void SimpleDisplayClass::BusWrite( const uint8_t *pusData, uint8_t usLength )
+{
+	while( 0 < usLength-- )
+	{
+		BusWrite( *pusData++ );
+	}
+}
+
+
+//**************************************************************************
+//	BusEnd (private)
+//--------------------------------------------------------------------------
+//	This function finishes the actual transmission.
+//	In asynchronous mode the transmission is committed to the transmit
+//	queue, otherwise it is sent to the display.
+//	A record in the queue consists of one byte 'number of bytes - 1'
+//	followed by the bytes of the transmission.
+//
+void SimpleDisplayClass::BusEnd( void )
+{
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+	if( m_bAsync )
+	{
+		if( 0 < m_uiRecordBytes )
+		{
+			m_arusQueue[ m_uiQueueRecord ]	 = (uint8_t)(m_uiRecordBytes - 1);
+			m_uiQueueTail					 = m_uiQueueWrite;
+			m_uiQueueUsed					+= m_uiRecordBytes + 1;
+
+			if( m_uiQueueHighWater < m_uiQueueUsed )
+			{
+				m_uiQueueHighWater = m_uiQueueUsed;
+			}
+		}
+
+		return;
+	}
+#endif
+
+	TransportEnd();
+}
+
+
+//**************************************************************************
+//	TransportBegin (private)
+//--------------------------------------------------------------------------
+//	This function starts a transmission on the bus (see Transport()).
+//
+void SimpleDisplayClass::TransportBegin( void )
+{
+#if SIMPLE_OLED_RECOVERY
+	if( LINK_LOST == m_usLink )
+	{
+		return;
+	}
+
+	m_uiRetryBytes = 0;
+#endif
+
+#if SIMPLE_OLED_STATS
+	m_ulBusStart = micros();
+#endif
+
+#if SIMPLE_OLED_TRACE_SIZE
+	m_uiTraceBytes = 0;
+	Trace( SIMPLE_OLED_TRACE_TX_BEGIN, 0 );
+#endif
+
+	m_clTransport.BeginTransmission( m_usAddress );
+}
+
+
+//**************************************************************************
+//	TransportWrite (private)
+//--------------------------------------------------------------------------
+//	This function adds one byte to the transmission on the bus.
+//	With recovery the byte is also kept for a repetition of the
+//	transmission (see RetryTransmission()).
+//
+void SimpleDisplayClass::TransportWrite( uint8_t usData )
+{
+#if SIMPLE_OLED_RECOVERY
+	if( LINK_LOST == m_usLink )
+	{
+		return;
+	}
+
+	if( I2C_BUFFER_SIZE > m_uiRetryBytes )
+	{
+		m_arusRetry[ m_uiRetryBytes++ ] = usData;
+	}
+#endif
+
+	m_clTransport.Write( usData );
+}
+
+
+//**************************************************************************
+//	TransportEnd (private)
+//--------------------------------------------------------------------------
+//	This function finishes the transmission on the bus, the bytes of the
+//	transmission are sent to the display.
+//
+void SimpleDisplayClass::TransportEnd( void )
+{
+#if SIMPLE_OLED_RECOVERY
+	if( LINK_LOST == m_usLink )
+	{
+		return;
+	}
+#endif
+
+#if SIMPLE_OLED_STATS || SIMPLE_OLED_TRACE_SIZE || SIMPLE_OLED_RECOVERY
+	uint8_t	usError = m_clTransport.EndTransmission();
+#else
+	m_clTransport.EndTransmission();
+#endif
+
+#if SIMPLE_OLED_STATS
+	if( 0 != usError )
+	{
+		m_tStats.ulErrors++;
+	}
+
+	m_tStats.ulTransactions++;
+	m_tStats.ulBusMicros += micros() - m_ulBusStart;
+#endif
+
+#if SIMPLE_OLED_TRACE_SIZE
+	if( 0 != usError )
+	{
+		Trace( SIMPLE_OLED_TRACE_TX_ERROR, usError );
+	}
+
+	Trace( SIMPLE_OLED_TRACE_TX_END, (uint8_t)((0xFF < m_uiTraceBytes) ? 0xFF : m_uiTraceBytes) );
+#endif
+
+#if SIMPLE_OLED_RECOVERY
+	if( (0 != usError) && (LINK_ONLINE == m_usLink) )
+	{
+		RetryTransmission( usError );
+	}
+#endif
+}
+
+
+//**************************************************************************
+//	CheckClock (private)
+//--------------------------------------------------------------------------
+//	This function checks the actual clock of the bus with TUNE_CHECKS
+//	probes and status reads. The status is read back from the display,
+//	it must show the display as 'on' (see Init()).
+//	Returns 'true' if all transmissions are acknowledged.
+//
+bool SimpleDisplayClass::CheckClock( void )
+{
+	uint8_t	usStatus;
+	uint8_t	usError = 0;
+
+	for( uint8_t idx = 0 ; (idx < TUNE_CHECKS) && (0 == usError) ; idx++ )
+	{
+		usError = m_clTransport.Probe( m_usAddress );
+
+		if( 0 == usError )
+		{
+			usError = m_clTransport.ReadStatus( m_usAddress, &usStatus );
+
+			if( (0 == usError) && (usStatus & SIMPLE_OLED_STATUS_DISPLAY_OFF) )
+			{
+				usError = 1;
+			}
+		}
+
+#if SIMPLE_OLED_STATS
+		if( 0 != usError )
+		{
+			m_tStats.ulErrors++;
+		}
+
+		m_tStats.ulTransactions += 3;
+		m_tStats.ulPayloadBytes += 2;
+#endif
+	}
+
+	return( 0 == usError );
+}
+
+
+#if SIMPLE_OLED_RECOVERY
+//**************************************************************************
+//	RetryTransmission (private)
+//--------------------------------------------------------------------------
+//	This function repeats the failed transmission with the kept bytes
+//	(see TransportWrite()). The pause before each repetition doubles.
+//	No repetition starts if the repetitions of the actual function call
+//	would take longer than the limit (see SetRecovery()).
+//	If all repetitions fail then the bus is cleared and the display is
+//	offline until Update() finds it again (see CheckLink()).
+//
+void SimpleDisplayClass::RetryTransmission( uint8_t usError )
+{
+	uint32_t	ulPause	= SIMPLE_OLED_RETRY_MICROS;
+	uint32_t	ulStart;
+
+	for( uint8_t usRetry = 1 ; usRetry <= m_usRetries ; usRetry++ )
+	{
+		if( ((uint32_t)m_usMaxBlockMillis * 1000UL) < (m_ulRetryMicros + ulPause) )
+		{
+			break;
+		}
+
+		ulStart = micros();
+		delayMicroseconds( ulPause );
+
+		if( RETRY_PAUSE_MAX > ulPause )
+		{
+			ulPause *= 2;
+		}
+
+#if SIMPLE_OLED_TRACE_SIZE
+		Trace( SIMPLE_OLED_TRACE_RETRY, usRetry );
+#endif
+
+		m_clTransport.BeginTransmission( m_usAddress );
+
+		for( uint16_t idx = 0 ; idx < m_uiRetryBytes ; idx++ )
+		{
+			m_clTransport.Write( m_arusRetry[ idx ] );
+		}
+
+		usError = m_clTransport.EndTransmission();
+
+#if SIMPLE_OLED_STATS
+		if( 0 != usError )
+		{
+			m_tStats.ulErrors++;
+		}
+
+		m_tStats.ulTransactions++;
+		m_tStats.ulPayloadBytes += m_uiRetryBytes;
+		m_tStats.ulBusMicros	+= micros() - ulStart;
+#endif
+
+#if SIMPLE_OLED_TRACE_SIZE
+		if( 0 != usError )
+		{
+			Trace( SIMPLE_OLED_TRACE_TX_ERROR, usError );
+		}
+
+		Trace( SIMPLE_OLED_TRACE_TX_END, (uint8_t)((0xFF < m_uiRetryBytes) ? 0xFF : m_uiRetryBytes) );
+#endif
+
+		m_ulRetryMicros += micros() - ulStart;
+
+		if( 0 == usError )
+		{
+			return;
+		}
+	}
+
+	//----------------------------------------------------------------------
+	//	the display does not answer: clear the bus and stop all output
+	//	to the display, the position in the display RAM is unknown
+	//
+	m_clTransport.ClearBus();
+
+	m_usLink			= LINK_LOST;
+	m_uiLinkTime		= (uint16_t)millis();
+	m_usRamPage			= RAM_ADDRESS_UNKNOWN;
+	m_usRamColumn		= RAM_ADDRESS_UNKNOWN;
+	m_bPositionValid	= false;
+
+#if SIMPLE_OLED_TRACE_SIZE
+	Trace( SIMPLE_OLED_TRACE_OFFLINE, usError );
+#endif
+}
+
+
+//**************************************************************************
+//	CheckLink (private)
+//--------------------------------------------------------------------------
+//	This function is called by Update().
+//	An offline display is looked for every SIMPLE_OLED_RECOVER_MILLIS,
+//	if it answers it is initialized again (see Recover()).
+//	The status of an online display is read every
+//	SIMPLE_OLED_CHECK_MILLIS while the transmit queue is empty. If the
+//	display is off although it was switched on by Init() then the display
+//	was reset and is initialized again.
+//
+void SimpleDisplayClass::CheckLink( void )
+{
+	uint16_t	uiNow = (uint16_t)millis();
+	uint8_t		usStatus;
+	uint8_t		usError;
+
+	if( LINK_LOST == m_usLink )
+	{
+		if( SIMPLE_OLED_RECOVER_MILLIS <= (uint16_t)(uiNow - m_uiLinkTime) )
+		{
+			m_uiLinkTime = uiNow;
+
+			m_clTransport.ClearBus();
+			usError = m_clTransport.Probe( m_usAddress );
+
+#if SIMPLE_OLED_STATS
+			if( 0 != usError )
+			{
+				m_tStats.ulErrors++;
+			}
+
+			m_tStats.ulTransactions++;
+#endif
+
+			if( 0 == usError )
+			{
+				Recover( SIMPLE_OLED_RECOVER_FOUND );
+			}
+		}
+	}
+#if 0 < SIMPLE_OLED_CHECK_MILLIS
+	else if(	(LINK_ONLINE == m_usLink)
+			&&	(SIMPLE_OLED_CHECK_MILLIS <= (uint16_t)(uiNow - m_uiLinkTime)) )
+	{
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+		if( 0 < m_uiQueueUsed )
+		{
+			return;
+		}
+#endif
+
+		m_uiLinkTime = uiNow;
+
+		usError = m_clTransport.ReadStatus( m_usAddress, &usStatus );
+
+#if SIMPLE_OLED_STATS
+		if( 0 != usError )
+		{
+			m_tStats.ulErrors++;
+		}
+
+		m_tStats.ulTransactions += 2;
+		m_tStats.ulPayloadBytes += 2;
+#endif
+
+		if( 0 != usError )
+		{
+			m_clTransport.ClearBus();
+
+			m_usLink			= LINK_LOST;
+			m_usRamPage			= RAM_ADDRESS_UNKNOWN;
+			m_usRamColumn		= RAM_ADDRESS_UNKNOWN;
+			m_bPositionValid	= false;
+
+#if SIMPLE_OLED_TRACE_SIZE
+			Trace( SIMPLE_OLED_TRACE_OFFLINE, usError );
+#endif
+		}
+		else if( usStatus & SIMPLE_OLED_STATUS_DISPLAY_OFF )
+		{
+			Recover( SIMPLE_OLED_RECOVER_RESET );
+		}
+	}
+#else
+	(void)usStatus;
+#endif
+}
+
+
+//**************************************************************************
+//	Recover (private)
+//--------------------------------------------------------------------------
+//	This function initializes the display again after it was offline or
+//	reset. The settings of the display (scroll position, flip, inverse)
+//	are sent again and then the content (see ReplayContent()).
+//
+void SimpleDisplayClass::Recover( uint8_t usCause )
+{
+	m_usLink			= LINK_ONLINE;
+	m_usRamPage			= RAM_ADDRESS_UNKNOWN;
+	m_usRamColumn		= RAM_ADDRESS_UNKNOWN;
+	m_bPositionValid	= false;
+
+	m_uiRecoveries++;
+
+#if SIMPLE_OLED_TRACE_SIZE
+	Trace( SIMPLE_OLED_TRACE_RECOVER, usCause );
+#else
+	(void)usCause;
+#endif
+
+	SendCommand( OPC_DISPLAY_LINE_OFFSET, m_usScrollRow );
+	SendCommand( OPC_ENTIRE_DISPLAY_NORMAL );
+	SendCommand( OPC_DISPLAY_ON );
+
+	if( m_bFlip )
+	{
+		SendCommand( OPC_SEG_ROTATION_LEFT );
+		SendCommand( OPC_OUTPUT_SCAN_INVERSE );
+	}
+	else
+	{
+		SendCommand( OPC_SEG_ROTATION_RIGHT );
+		SendCommand( OPC_OUTPUT_SCAN_NORMAL );
+	}
+
+	SendCommand( m_bInverseDisplay ? OPC_MODE_INVERSE : OPC_MODE_NORMAL );
+	EndStream();
+
+	ReplayContent();
+}
+#endif
+
+
+//**************************************************************************
+//	ReplayContent (private)
+//--------------------------------------------------------------------------
+//	This function transmits the content of the display again (see
+//	Recover() and SetDisplayColumnOffset()).
+//	With framebuffer all pages are transmitted. Without framebuffer the
+//	characters of the text shadow are written again, cells with unknown
+//	content (e.g. graphics) and the columns beside the text are cleared.
+//	Without text shadow and framebuffer the display is only cleared.
+//
+void SimpleDisplayClass::ReplayContent( void )
+{
+#if SIMPLE_OLED_FRAMEBUFFER
+	memset( m_arusDirtyFirst, 0, sizeof( m_arusDirtyFirst ) );
+	memset( m_arusDirtyLast, DISPLAY_COLUMNS - 1, sizeof( m_arusDirtyLast ) );
+
+	Flush();
+#else
+	for( uint8_t usPage = 0 ; usPage < SIMPLE_OLED_PAGES ; usPage++ )
+	{
+		uint8_t	usColumn = 0;
+
+		SendPosition( usPage, 0 );
+
+#if SIMPLE_OLED_TEXT_SHADOW
+		uint8_t	usLine = usPage / PAGES_CHAR_HEIGHT;
+
+		if( TEXT_LINES > usLine )
+		{
+			const uint8_t	*pusShadow = &m_arusTextShadow[ usLine * TEXT_COLUMNS ];
+
+			for( ; usColumn < m_usColumnOffset ; usColumn++ )
+			{
+				StreamData( 0 );
+			}
+
+			for( uint8_t idx = 0 ; idx < TEXT_COLUMNS ; idx++ )
+			{
+				if( SHADOW_UNKNOWN == pusShadow[ idx ] )
+				{
+					for( uint8_t usX = 0 ; usX < PIXELS_CHAR_WIDTH ; usX++ )
+					{
+						StreamData( 0 );
+					}
+				}
+				else
+				{
+					WriteGlyphPage( pusShadow[ idx ], usPage % PAGES_CHAR_HEIGHT );
+				}
+
+				usColumn += PIXELS_CHAR_WIDTH;
+			}
+		}
+#endif
+
+		for( ; usColumn < DISPLAY_COLUMNS ; usColumn++ )
+		{
+			StreamData( 0 );
+		}
+
+		EndStream();
+	}
+
+	m_bPositionValid = false;
+#endif
+}
+
+
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+//**************************************************************************
+//	SendQueued (private)
+//--------------------------------------------------------------------------
+//	This function sends the oldest transmission of the transmit queue to
+//	the display.
+//
+void SimpleDisplayClass::SendQueued( void )
+{
+	uint16_t	uiBytes	= m_arusQueue[ m_uiQueueHead ] + 1;
+
+	m_uiQueueHead	 = QueueNext( m_uiQueueHead );
+	m_uiQueueUsed	-= uiBytes + 1;
+
+	TransportBegin();
+
+#if SIMPLE_OLED_STATS
+	m_tStats.ulPayloadBytes += uiBytes;
+#endif
+
+#if SIMPLE_OLED_TRACE_SIZE
+	m_uiTraceBytes = uiBytes;
+#endif
+
+	while( 0 < uiBytes-- )
+	{
+		TransportWrite( m_arusQueue[ m_uiQueueHead ] );
+		m_uiQueueHead = QueueNext( m_uiQueueHead );
+	}
+
+	TransportEnd();
+}
+
+
+//**************************************************************************
+//	QueueNext (private)
+//--------------------------------------------------------------------------
+//	This function returns the index that follows the given index in the
+//	ring buffer of the transmit queue.
+//
+uint16_t SimpleDisplayClass::QueueNext( uint16_t uiIdx )
+{
+	uiIdx++;
+
+	if( SIMPLE_OLED_TX_QUEUE_SIZE <= uiIdx )
+	{
+		uiIdx = 0;
+	}
+
+	return( uiIdx );
+}
+#endif
+
+
+//**************************************************************************
+//	FormatFixed (private)
+//--------------------------------------------------------------------------
+//	This function writes the fixed point value right-aligned into the
+//	buffer pcField of usWidth characters (see PrintFixed()).
+//	The buffer is not terminated with '\0'.
+//
+void SimpleDisplayClass::FormatFixed( char *pcField, uint8_t usWidth, int32_t lValue, uint8_t usDecimals )
+{
+	uint32_t	ulValue;
+	uint8_t		usPos		= usWidth;
+	uint8_t		usDigits	= 0;
+	bool		bNegative	= (0 > lValue);
+	bool		bOverflow	= false;
+
+	//------------------------------------------------------------------
+	//	amount of the value, this works also for the smallest
+	//	negative value
+	//
+	ulValue = bNegative ? ((uint32_t)(-(lValue + 1)) + 1) : (uint32_t)lValue;
+
+	//------------------------------------------------------------------
+	//	fill the field from the right side, at least one digit in
+	//	front of the decimal point
+	//
+	do
+	{
+		if( (0 < usDecimals) && (usDigits == usDecimals) )
+		{
+			if( 0 == usPos )
+			{
+				bOverflow = true;
+				break;
+			}
+
+			pcField[ --usPos ] = '.';
+		}
+
+		if( 0 == usPos )
+		{
+			bOverflow = true;
+			break;
+		}
+
+		pcField[ --usPos ] = '0' + (uint8_t)(ulValue % 10);
+
+		ulValue /= 10;
+		usDigits++;
+	}
+	while( (0 != ulValue) || (usDigits <= usDecimals) );
+
+	if( bNegative && !bOverflow )
+	{
+		if( 0 == usPos )
+		{
+			bOverflow = true;
+		}
+		else
+		{
+			pcField[ --usPos ] = '-';
+		}
 	}
 
-	//----------------------------------------------------------------------
-	//	Set the display line offset back to the default value '0'.
-	//	That means beginn to display the display with the top line.
-	//
-	m_usLineOffset = 0;
+	if( bOverflow )
+	{
+		memset( pcField, '*', usWidth );
+	}
+	else
+	{
+		memset( pcField, ' ', usPos );
+	}
+}
 
-	SendCommand( OPC_DISPLAY_LINE_OFFSET, 0 );
 
-	//----------------------------------------------------------------------
-	//	set the cursor to home position
-	//
-	SetCursor( 0, 0 );
+//**************************************************************************
+//	ReadField (private)
+//--------------------------------------------------------------------------
+//	This function copies the definition of the field with the index
+//	usField of the actual layout from PROGMEM to ptField.
+//	If there is no such field then 'false' is returned.
+//
+bool SimpleDisplayClass::ReadField( uint8_t usField, SimpleOledField *ptField )
+{
+	SimpleOledLayout	tLayout;
+
+	if( NULL == m_ptLayout )
+	{
+		return( false );
+	}
+
+	memcpy_P( &tLayout, m_ptLayout, sizeof( tLayout ) );
+
+	if( tLayout.usFields <= usField )
+	{
+		return( false );
+	}
+
+	memcpy_P( ptField, &tLayout.ptFields[ usField ], sizeof( *ptField ) );
+
+	return( (TEXT_LINES > ptField->usTextLine) && (TEXT_COLUMNS > ptField->usTextColumn) );
 }
 
 
 //**************************************************************************
-//	ClearLine
+//	WriteField (private)
 //--------------------------------------------------------------------------
-//	The function deletes the text line at the given cursor position and
-//	sets the cursor to the bginning of that line.
+//	This function prints usLength characters of pcText into the field
+//	with the index usField. The text is aligned as defined for the
+//	field, the rest of the field is filled with spaces.
 //
-void SimpleDisplayClass::ClearLine( uint8_t usLineToClear )
+void SimpleDisplayClass::WriteField( uint8_t usField, const char *pcText, uint8_t usLength )
 {
-	//------------------------------------------------------------------
-	//	at the end of the function the cursor will be positioned to
-	//	the beginning of the line that will be cleared
-	//
-	m_usTextLine	= usLineToClear;
-	m_usTextColumn	= 0;
+	SimpleOledField	tField;
+	uint8_t			usWidth;
+	uint8_t			usLeft;
+	bool			bInverse = m_bInverse;
 
-	//------------------------------------------------------------------
-	//	take care of the display line shift
-	//	and correct the line to clear accordingly
-	//
-	usLineToClear += m_usLineOffset;
+	if( !ReadField( usField, &tField ) )
+	{
+		return;
+	}
 
-	if( TEXT_LINES <= usLineToClear )
+	usWidth = tField.usWidth;
+
+	if( (TEXT_COLUMNS - tField.usTextColumn) < usWidth )
 	{
-		usLineToClear -= TEXT_LINES;
+		usWidth = TEXT_COLUMNS - tField.usTextColumn;
 	}
 
-	//------------------------------------------------------------------
-	//	preparation for the command that will be send to the display
-	//		set cursor to actual line first column
-	//
-	usLineToClear &= MASK_PAGE_ADDRESS;
-	g_arusPositionCommandBuffer[ IDX_PAGE_ADDRESS ] = usLineToClear | OPC_PAGE_ADDRESS;
-	g_arusPositionCommandBuffer[ IDX_COLUMN_ADDRESS_LOW  ] = OPC_COLUMN_ADDRESS_LOW;
-	g_arusPositionCommandBuffer[ IDX_COLUMN_ADDRESS_HIGH ] = OPC_COLUMN_ADDRESS_HIGH;
+	if( usWidth < usLength )
+	{
+		usLength = usWidth;
+	}
 
 	//------------------------------------------------------------------
-	//	now send the commands to position the cursor to the display
+	//	number of spaces in front of the text
 	//
-	Wire.beginTransmission( m_usAddress );
-	Wire.write( g_arusPositionCommandBuffer, sizeof( g_arusPositionCommandBuffer ) );
-	Wire.endTransmission();
-
-	for( uint8_t idx1 = 0 ; idx1 < 6 ; idx1++ )
+	switch( tField.usFormat & SIMPLE_OLED_ALIGN_MASK )
 	{
-		Wire.beginTransmission( m_usAddress );
+		case SIMPLE_OLED_ALIGN_RIGHT:	usLeft = usWidth - usLength;			break;
+		case SIMPLE_OLED_ALIGN_CENTER:	usLeft = (usWidth - usLength) >> 1;	break;
+		default:						usLeft = 0;							break;
+	}
+
+	m_bInverse = (0 != (tField.usFormat & SIMPLE_OLED_INVERSE));
 
-		Wire.write( PREFIX_DATA );
+	SetCursor( tField.usTextLine, tField.usTextColumn );
 
-		for( uint8_t idx2 = 0 ; idx2 < 22 ; idx2++ )
+	for( uint8_t idx = 0 ; idx < usWidth ; idx++ )
+	{
+		if( (usLeft <= idx) && ((usLeft + usLength) > idx) )
+		{
+			WriteGlyph( pcText[ idx - usLeft ] );
+		}
+		else
 		{
-			Wire.write( 0x00 );
+			WriteGlyph( ' ' );
 		}
+	}
+
+	EndData();
+
+	m_bInverse = bInverse;
+}
 
-		Wire.endTransmission();
+
+#if SIMPLE_OLED_FRAMEBUFFER
+//**************************************************************************
+//	IsFrameDirty (private)
+//--------------------------------------------------------------------------
+//	The function returns 'true' if there are changes in the framebuffer
+//	that are not yet transmitted (see Flush()).
+//
+bool SimpleDisplayClass::IsFrameDirty( void )
+{
+	for( uint8_t usPage = 0 ; usPage < SIMPLE_OLED_PAGES ; usPage++ )
+	{
+		if( m_arusDirtyFirst[ usPage ] <= m_arusDirtyLast[ usPage ] )
+		{
+			return( true );
+		}
 	}
 
-	//------------------------------------------------------------------
-	//	set cursor to first text position of this line
-	//
-	g_arusPositionCommandBuffer[ IDX_COLUMN_ADDRESS_LOW  ] =	  OPC_COLUMN_ADDRESS_LOW
-																| g_usDisplayColumnOffset;
+	return( false );
+}
+#endif
+
 
-	Wire.beginTransmission( m_usAddress );
-	Wire.write( g_arusPositionCommandBuffer, sizeof( g_arusPositionCommandBuffer ) );
-	Wire.endTransmission();
+//**************************************************************************
+//	InvalidateTextShadow (private)
+//--------------------------------------------------------------------------
+//	This function marks the content of all character cells as unknown.
+//	So the next output to each cell will be transmitted to the display.
+//
+void SimpleDisplayClass::InvalidateTextShadow( void )
+{
+#if SIMPLE_OLED_TEXT_SHADOW
+	memset( m_arusTextShadow, SHADOW_UNKNOWN, sizeof( m_arusTextShadow ) );
+#endif
 }
 
 
 //**************************************************************************
-//	SetInverse
+//	InvalidateTextCells (private)
 //--------------------------------------------------------------------------
-//	This function inverses the display, means every OLED pixel that is 'on'
-//	will be turned 'off' and vice versa.
+//	This function marks the character cells as unknown that are touched
+//	by graphics in the columns usX to usX + usWidth - 1 of the page usPage
+//	of the display RAM. So the next text output to these cells will be
+//	transmitted to the display.
 //
-void SimpleDisplayClass::SetInverse( bool bInverse )
+void SimpleDisplayClass::InvalidateTextCells( uint8_t usPage, uint8_t usX, uint8_t usWidth )
 {
-	if( bInverse )
+#if SIMPLE_OLED_TEXT_SHADOW
+	uint8_t	usLine	= usPage / PAGES_CHAR_HEIGHT;
+	uint8_t	usFirst	= usX / PIXELS_CHAR_WIDTH;
+	uint8_t	usLast	= (usX + usWidth - 1) / PIXELS_CHAR_WIDTH;
+
+	if( (TEXT_LINES <= usLine) || (TEXT_COLUMNS <= usFirst) )
 	{
-		SendCommand( OPC_MODE_INVERSE );
+		return;
 	}
-	else
+
+	if( TEXT_COLUMNS <= usLast )
 	{
-		SendCommand( OPC_MODE_NORMAL );
+		usLast = TEXT_COLUMNS - 1;
 	}
+
+	memset( &m_arusTextShadow[ (usLine * TEXT_COLUMNS) + usFirst ], SHADOW_UNKNOWN, usLast - usFirst + 1 );
+#else
+	(void)usPage;
+	(void)usX;
+	(void)usWidth;
+#endif
 }
 
 
 //**************************************************************************
-//	Flip
+//	ClipArea (private)
 //--------------------------------------------------------------------------
-//	This function will turn the output on the display by 180 degree
-//	and clears the display.
+//	This function cuts width and height of an area in pixels to the part
+//	that is visible on the display.
+//	Returns false if nothing of the area is visible.
 //
-void SimpleDisplayClass::Flip( bool bFlip )
+bool SimpleDisplayClass::ClipArea( uint8_t usX, uint8_t usY, uint8_t *pusWidth, uint8_t *pusHeight )
 {
-	if( bFlip )
+	if( (SIMPLE_OLED_VISIBLE_COLUMNS <= usX) || (DISPLAY_LINES <= usY) )
 	{
-		SendCommand( OPC_SEG_ROTATION_LEFT );
-		SendCommand( OPC_OUTPUT_SCAN_INVERSE );
+		return( false );
 	}
-	else
+
+	if( (SIMPLE_OLED_VISIBLE_COLUMNS - usX) < *pusWidth )
 	{
-		SendCommand( OPC_SEG_ROTATION_RIGHT );
-		SendCommand( OPC_OUTPUT_SCAN_NORMAL );
+		*pusWidth = SIMPLE_OLED_VISIBLE_COLUMNS - usX;
 	}
-	
-	Clear();
+
+	if( (DISPLAY_LINES - usY) < *pusHeight )
+	{
+		*pusHeight = DISPLAY_LINES - usY;
+	}
+
+	return( (0 < *pusWidth) && (0 < *pusHeight) );
 }
 
 
 //**************************************************************************
-//	SetPrintModeOverwriteSameLine
+//	FillArea (private)
 //--------------------------------------------------------------------------
-//	This function sets the PrintMode to overwrite same line.
-//	Overwrite same line means:
-//	if the text output comes to the end of a line then continue with the
-//	output in the same line and overwrite an existing text.
+//	This function sets (bOn = true) or clears the pixels of a rectangle
+//	page by page (see FillRect()). The pages that are covered completely
+//	are written with whole bytes, only the first and the last page of the
+//	rectangle may need a mask.
+//	The open transmission is not finished, so several areas can go out
+//	together.
 //
-void SimpleDisplayClass::SetPrintModeOverwriteSameLine( void )
+void SimpleDisplayClass::FillArea( uint8_t usX, uint8_t usY, uint8_t usWidth, uint8_t usHeight, bool bOn )
 {
-	m_usPrintMode = PM_OVERWRITE_SAME_LINE;
+	uint8_t	usBits	= bOn ? 0xFF : 0x00;
+	uint8_t	usRow	= usY;
+
+	if( !ClipArea( usX, usY, &usWidth, &usHeight ) )
+	{
+		return;
+	}
+
+	while( (usY + usHeight) > usRow )
+	{
+		uint8_t	usMask = RowMask( usRow, usY + usHeight );
+
+		SetGraphicPosition( usRow, usX, usWidth );
+
+		if( 0xFF == usMask )
+		{
+			//----------------------------------------------------------
+			//	the page is covered completely: whole bytes
+			//
+			for( uint8_t idx = 0 ; idx < usWidth ; idx++ )
+			{
+				WriteData( usBits );
+			}
+		}
+		else
+		{
+			for( uint8_t idx = 0 ; idx < usWidth ; idx++ )
+			{
+				WriteBits( usMask, usBits );
+			}
+		}
+
+		usRow = (usRow | (PIXELS_PAGE_HEIGHT - 1)) + 1;
+	}
 }
 
 
 //**************************************************************************
-//	SetPrintModeOverwriteNextLine
+//	RowMask (private)
 //--------------------------------------------------------------------------
-//	This function sets the PrintMode to overwrite next line.
-//	Overwrite next line means:
-//	if the text output comes to the end of a line then continue with the
-//	output in the next line and perhaps overwrite an existing text.
-//	if it was the last line of the display then jumpt to the first line and
-//	continue the output there.
+//	This function returns the bits of the page of the pixel row usRow
+//	that belong to the rows usRow to usEndRow - 1 (bit 0 is the top row
+//	of the page). 0xFF means the page is covered completely.
 //
-void SimpleDisplayClass::SetPrintModeOverwriteNextLine( void )
+uint8_t SimpleDisplayClass::RowMask( uint8_t usRow, uint8_t usEndRow )
 {
-	m_usPrintMode = PM_OVERWRITE_NEXT_LINE;
+	uint8_t	usMask = 0xFF << (usRow % PIXELS_PAGE_HEIGHT);
+
+	if( (usEndRow - (usRow - (usRow % PIXELS_PAGE_HEIGHT))) < PIXELS_PAGE_HEIGHT )
+	{
+		usMask &= (uint8_t)(0xFF >> (PIXELS_PAGE_HEIGHT - (usEndRow % PIXELS_PAGE_HEIGHT)));
+	}
+
+	return( usMask );
 }
 
 
 //**************************************************************************
-//	SetPrintModeScrollLine
+//	SetGraphicPosition (private)
 //--------------------------------------------------------------------------
-//	This function sets the PrintMode to scroll line.
-//	Scroll line means:
-//	if the text output comes to the end of a line then continue with the
-//	output in the next line.
-//	If it was the last line of the display then scroll all lines one up
-//	discarding the first line, clear the last line and continue the output
-//	in the cleared last line.
+//	This function sets the write position to the page of the display RAM
+//	that is shown at the pixel row usRow and to the pixel column usX.
+//	Because of the display line offset (PrintMode scroll line) the page
+//	of the display RAM is not always the same as the page on the screen.
+//	The character cells of the usWidth columns are marked as unknown in
+//	the text shadow. Without framebuffer the usWidth columns are the span
+//	that WriteBits() reads back from the display (see ReadSpan()).
 //
-void SimpleDisplayClass::SetPrintModeScrollLine( void )
+void SimpleDisplayClass::SetGraphicPosition( uint8_t usRow, uint8_t usX, uint8_t usWidth )
 {
-	m_usPrintMode = PM_SCROLL_LINE;
+	uint8_t	usPage = (usRow / PIXELS_PAGE_HEIGHT) + (m_usLineOffset * PAGES_CHAR_HEIGHT);
+
+	if( SIMPLE_OLED_PAGES <= usPage )
+	{
+		usPage -= SIMPLE_OLED_PAGES;
+	}
+
+	InvalidateTextCells( usPage, usX, usWidth );
+
+	SetWritePosition( usPage, usX + m_usColumnOffset );
+
+#if SIMPLE_OLED_READ_BACK
+	m_usReadBytes	= 0;
+	m_usSpanEnd		= usX + m_usColumnOffset + usWidth;
+#endif
 }
 
 
 //**************************************************************************
-//	SetDisplayColumnOffset
+//	WriteBits (private)
 //--------------------------------------------------------------------------
-//	With this function it is possible to adjust the display in left right
-//	direction in a small range.
-//
-//	Background:
-//	The OLED display that I used during development of this library has
-//	132 columns of OLED pixels. The font I use has 8 pixels per character.
-//	So 128 pixels are used for one text line. This leads to a left over
-//	of 4 pixels that can be used to adjust the text output on the display.
+//	This function writes the bits of usBits that are set in usMask at the
+//	actual write position (see WriteData()).
+//	The other bits of the byte are kept: with framebuffer they come from
+//	the framebuffer, on the I²C bus they are read from the display RAM
+//	(see ReadSpan()). The 4-wire SPI interface can not read the display
+//	RAM, so there without framebuffer the other bits are cleared.
 //
-void SimpleDisplayClass::SetDisplayColumnOffset( uint8_t usOffset )
+void SimpleDisplayClass::WriteBits( uint8_t usMask, uint8_t usBits )
 {
-	if( (DISPLAY_COLUMN_OFFSET_MIN <= usOffset) && (DISPLAY_COLUMN_OFFSET_MAX >= usOffset) )
+	usBits &= usMask;
+
+#if SIMPLE_OLED_FRAMEBUFFER
+	if( DISPLAY_COLUMNS > m_usWriteColumn )
+	{
+		usBits |= m_arusFrame[ m_usWritePage ][ m_usWriteColumn ] & ~usMask;
+	}
+#elif SIMPLE_OLED_READ_BACK
+	if( 0xFF != usMask )
 	{
-		g_usDisplayColumnOffset = usOffset;
+		//------------------------------------------------------------------
+		//	the span is read in pieces as big as the buffer, a piece is
+		//	read when the write position leaves the bytes of the last one
+		//
+		uint8_t	usIndex = m_usRamColumn - m_usReadColumn;
+
+		if( (m_usReadBytes <= usIndex) && (m_usSpanEnd > m_usRamColumn) )
+		{
+			ReadSpan();
+
+			usIndex = 0;
+		}
 
-		SendCommand( OPC_DISPLAY_LINE_OFFSET, usOffset );
+		if( usIndex < m_usReadBytes )
+		{
+			usBits |= m_arusReadBack[ usIndex ] & ~usMask;
+		}
 	}
+#endif
+
+	WriteData( usBits );
 }
 
 
+#if SIMPLE_OLED_READ_BACK
 //**************************************************************************
-//	SendCommand (private)
+//	ReadSpan (private)
 //--------------------------------------------------------------------------
-//	This function will send a one byte command to the display.
-//	A one byte command exists of
-//		-	1 byte prefix
-//		-	1 byte command code
+//	This function reads the bytes of the display RAM from the actual write
+//	position up to the end of the span (see SetGraphicPosition()) into
+//	the read back buffer, at most SIMPLE_OLED_READ_BACK_BYTES in one
+//	read. The read needs the display RAM as it is after all transmissions
+//	before it, so the open transmission and the transmit queue are sent
+//	first.
+//	The read-modify-write mode of the display does not move the column
+//	address with a read, so it can read only one byte per read. A normal
+//	read moves the column address with every byte, so the position is
+//	sent again and the merged bytes go out with the next data as one
+//	transmission (see WriteBits()).
+//	If the bytes can not be read they are taken as cleared.
 //
-void SimpleDisplayClass::SendCommand( uint8_t usOpCode )
+void SimpleDisplayClass::ReadSpan( void )
 {
-	Wire.beginTransmission( m_usAddress );
+	uint8_t	usPage		= m_usRamPage;
+	uint8_t	usColumn	= m_usRamColumn;
+	uint8_t	usCount		= SIMPLE_OLED_READ_BACK_BYTES;
+	bool	bRead		= false;
+
+	if( usCount > (m_usSpanEnd - usColumn) )
+	{
+		usCount = m_usSpanEnd - usColumn;
+	}
+
+	m_usReadColumn	= usColumn;
+	m_usReadBytes	= usCount;
+
+	EndStream();
+
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+	while( 0 < m_uiQueueUsed )
+	{
+		SendQueued();
+	}
+#endif
+
+#if SIMPLE_OLED_RECOVERY
+	if( LINK_LOST != m_usLink )
+#endif
+	{
+		bRead = (0 == m_clTransport.ReadData( m_usAddress, m_arusReadBack, usCount ));
 
-	Wire.write( PREFIX_LAST_COMMAND );
-	Wire.write( usOpCode );
+#if SIMPLE_OLED_STATS
+		if( !bRead )
+		{
+			m_tStats.ulErrors++;
+		}
+
+		m_tStats.ulTransactions += 2;
+		m_tStats.ulPayloadBytes += usCount + 2;
+#endif
+	}
+
+	if( !bRead )
+	{
+		memset( m_arusReadBack, 0x00, usCount );
+	}
+
+	m_usRamColumn = RAM_ADDRESS_UNKNOWN;
 
-	Wire.endTransmission();
+	SendPosition( usPage, usColumn );
 }
+#endif
 
 
 //**************************************************************************
-//	SendCommand (private)
+//	DisplayLine (private)
 //--------------------------------------------------------------------------
-//	This function will send a two byte command to the display.
-//	A two byte command exists of
-//		-	1 byte prefix
-//		-	1 byte command code
-//		-	1 byte parameter
+//	The function returns the line of the display RAM that is shown in the
+//	given text line. Because of the display line offset (PrintMode scroll
+//	line) text line and line of the display RAM are not always the same.
+//	The first page of the line is this value * PAGES_CHAR_HEIGHT.
 //
-void SimpleDisplayClass::SendCommand( uint8_t usOpCode, uint8_t usParameter )
+uint8_t SimpleDisplayClass::DisplayLine( uint8_t usTextLine )
 {
-	Wire.beginTransmission( m_usAddress );
+	usTextLine += m_usLineOffset;
 
-	Wire.write( PREFIX_LAST_COMMAND );
-	Wire.write( usOpCode );
-	Wire.write( usParameter );
+	if( TEXT_LINES <= usTextLine )
+	{
+		usTextLine -= TEXT_LINES;
+	}
 
-	Wire.endTransmission();
+	return( usTextLine );
 }
 
 
@@ -737,23 +3909,48 @@ void SimpleDisplayClass::SendCommand( uint8_t usOpCode, uint8_t usParameter )
 //
 void SimpleDisplayClass::NextLine( bool bShiftLine )
 {
+	//----------------------------------------------------------------------
+	//	the cursor will be repositioned, so send the collected data first
+	//
+	EndData();
+
 	m_usTextColumn	= 0;
 
 	if( PM_SCROLL_LINE == m_usPrintMode )
 	{
 		//------------------------------------------------------------------
 		//	PrintMode is scroll line
-		//	if		the cursor is in the last line of the display,
-		//	then	stay there and shift all other lines one up
+		//	if		the cursor is in the last line of the scroll region,
+		//	then	stay there and shift all other lines of the region
+		//			one up
 		//	else	set cursor to the next line
+		//	The whole display is shifted with the display line offset.
+		//	That is not possible for a part of the display or if the
+		//	text lines do not fill the display (scaled fonts), there the
+		//	lines are rewritten (see ScrollRegion()).
+		//	A fixed line outside the scroll region is never left or
+		//	cleared, the cursor goes back to its first column.
 		//
-		if( (TEXT_LINES - 1) == m_usTextLine )
+		if( (m_usScrollFirst > m_usTextLine) || (m_usScrollLast < m_usTextLine) )
+		{
+			SetCursor( m_usTextLine, m_usTextColumn );
+
+			return;
+		}
+
+		if( m_usScrollLast != m_usTextLine )
+		{
+			m_usTextLine++;
+		}
+		else if(	SCROLL_BY_LINE_OFFSET
+				&&	(0 == m_usScrollFirst)
+				&&	((TEXT_LINES - 1) == m_usScrollLast) )
 		{
 			ShiftDisplayOneLine();
 		}
 		else
 		{
-			m_usTextLine++;
+			ScrollRegion();
 		}
 	}
 	else if( bShiftLine || (PM_OVERWRITE_NEXT_LINE == m_usPrintMode) )
@@ -787,12 +3984,63 @@ void SimpleDisplayClass::NextLine( bool bShiftLine )
 
 
 //**************************************************************************
-//	SetDisplayLineOffset (private)
+//	ScrollRegion (private)
+//--------------------------------------------------------------------------
+//	The function shifts the lines of the scroll region one line up by
+//	writing the text of the line below into each line. The text comes
+//	from the text shadow, so only the characters that differ are
+//	transmitted. The last line of the region is cleared by NextLine().
+//	Without text shadow the cursor goes to the first line of the region.
+//
+void SimpleDisplayClass::ScrollRegion( void )
+{
+#if SIMPLE_OLED_TEXT_SHADOW
+	bool	bInverse = m_bInverse;
+
+	for( uint8_t usLine = m_usScrollFirst ; usLine < m_usScrollLast ; usLine++ )
+	{
+		const uint8_t	*pusSource = &m_arusTextShadow[ DisplayLine( usLine + 1 ) * TEXT_COLUMNS ];
+
+		SetCursor( usLine, 0 );
+
+		for( uint8_t idx = 0 ; idx < TEXT_COLUMNS ; idx++ )
+		{
+			uint8_t	usCell = pusSource[ idx ];
+
+			if( SHADOW_UNKNOWN == usCell )
+			{
+				usCell = ' ';
+			}
+
+			m_bInverse = (0 != (usCell & SHADOW_INVERSE));
+
+			WriteGlyph( usCell & ~SHADOW_INVERSE );
+		}
+
+		EndData();
+	}
+
+	m_bInverse		= bInverse;
+	m_usTextLine	= m_usScrollLast;
+	m_usTextColumn	= 0;
+#else
+	m_usTextLine	= m_usScrollFirst;
+#endif
+}
+
+
+//**************************************************************************
+//	ShiftDisplayOneLine (private)
 //--------------------------------------------------------------------------
-//	Die Funktion
+//	The function shifts the display one text line up.
+//	Without smooth scroll the display line offset is sent at once,
+//	with smooth scroll Update() moves the display to the new line offset
+//	step by step.
 //
 void SimpleDisplayClass::ShiftDisplayOneLine( void )
 {
+	FinishScroll();
+
 	m_usLineOffset++;
 	
 	if( TEXT_LINES <= m_usLineOffset )
@@ -800,5 +4048,35 @@ void SimpleDisplayClass::ShiftDisplayOneLine( void )
 		m_usLineOffset = 0;
 	}
 
-	SendCommand( OPC_DISPLAY_LINE_OFFSET, (m_usLineOffset << 3) );
+	if( m_bSmoothScroll )
+	{
+		//------------------------------------------------------------------
+		//	the first step follows after usStepMillis
+		//
+		m_uiScrollStepTime = (uint16_t)millis();
+	}
+	else
+	{
+		m_usScrollRow = SCROLL_ROW( m_usLineOffset );
+
+		SendCommand( OPC_DISPLAY_LINE_OFFSET, m_usScrollRow );
+	}
+}
+
+
+//**************************************************************************
+//	FinishScroll (private)
+//--------------------------------------------------------------------------
+//	If the smooth scroll has not yet reached the actual line then the
+//	display line offset of the actual line is sent at once.
+//
+void SimpleDisplayClass::FinishScroll( void )
+{
+	if( IsScrolling() )
+	{
+		m_usScrollRow = SCROLL_ROW( m_usLineOffset );
+
+		SendCommand( OPC_DISPLAY_LINE_OFFSET, m_usScrollRow );
+		EndStream();
+	}
 }
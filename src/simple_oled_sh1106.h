@@ -14,6 +14,216 @@
 //#
 //#-------------------------------------------------------------------------
 //#
+//#	Version: 1.27	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add SetBusClock() and AutoTuneClock(): the clock of the bus is kept
+//#			when the bus is started again, the auto tune tries 100 kHz, 400 kHz
+//#			and 1 MHz with probes and status reads and keeps the fastest clock
+//#			that works (see simple_oled_config.h: SIMPLE_OLED_WIRE_CLOCK)
+//#		-	transport: GetClock(), SetClock() of the Wire transport
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.26	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add recovery from bus errors: a failed transmission is repeated with a
+//#			doubling pause within a time limit per function call, then the bus is
+//#			cleared and the display is offline until Update() finds it again or
+//#			reads that it was reset, then it is initialized and gets its content
+//#			again (SetRecovery(), IsOnline(), RecoveryCount(), see simple_oled_config.h:
+//#			SIMPLE_OLED_RECOVERY)
+//#		-	transport: SetTimeout(), ClearBus() and ReadStatus()
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.25	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add a trace: the calls of the public functions and the transmissions
+//#			with their bytes and the time since the previous record in a ring of
+//#			records with 4 bytes (DumpTrace(), ClearTrace(), see simple_oled_config.h:
+//#			SIMPLE_OLED_TRACE_SIZE)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.24	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add statistics: transmissions, bytes, address commands, errors, time on
+//#			the bus and the longest call of the public functions (GetStats(),
+//#			ResetStats(), see simple_oled_config.h: SIMPLE_OLED_STATS)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.23	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add SetRefreshRate(): with framebuffer the output only changes the
+//#			framebuffer and Update() transmits the changes at most once per frame
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.22	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add DrawColumn() that writes one pixel column with one byte per page,
+//#			used by the widgets SimpleOledSparkline and SimpleOledBarGraph
+//#			(see simple_oled_widgets.h)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.21	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add graphics: DrawPixel(), DrawHLine(), DrawVLine(), DrawRect(), FillRect()
+//#			and DrawBitmap(), pages that are covered completely are written with
+//#			whole bytes, with framebuffer only the touched columns are flushed
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.20	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add scroll regions for the PrintMode scroll line (SetScrollRegion()),
+//#			the lines of a region are rewritten from the text shadow, the whole
+//#			display is still shifted with the display line offset
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.19	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add the smooth scroll for the PrintMode scroll line, Update() moves
+//#			the display one pixel row per step (SetSmoothScroll(), IsScrolling())
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.18	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add the fonts 6x8 and 8x16 and the scaling of the font by 2 or 3
+//#			(see simple_oled_config.h: SIMPLE_OLED_FONT, SIMPLE_OLED_FONT_SCALE),
+//#			characters higher than one page are sent page by page for the
+//#			whole run of characters
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.17	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add layouts: labels and fields are defined once in PROGMEM,
+//#			ShowLayout() prints the labels, SetField() and SetFieldNumber()
+//#			print only the changed characters of a field
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.16	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add the functions PrintNumber() and PrintFixed() for right-aligned
+//#			number fields
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.15	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	derive the class from the class Print of the Arduino core, write()
+//#			sends the characters directly into the data transmission
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.14	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	keep the display column offset per display, so more displays can be
+//#			used at the same time
+//#		-	fix: Init() rejected the address SECOND_DISPLAY_ADDRESS
+//#		-	add the class SimpleDisplayManager for several displays on one bus
+//#			(see simple_oled_manager.h)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.13	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	keep track of the page and column address of the display RAM and
+//#			send only the parts of the address that have changed
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.12	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	send sequences of commands and the following display data in one
+//#			transmission (command stream), also in Init(), Flip() and SetCursor()
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.11	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add the transports SimpleOledWireTransport, SimpleOledSpiTransport
+//#			and SimpleOledSoftI2cTransport and the function Transport()
+//#			(see simple_oled_config.h: SIMPLE_OLED_TRANSPORT)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.10	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add an optional transmit queue for an asynchronous mode
+//#			and the functions SetAsync(), Update(), WaitIdle() and QueueHighWater()
+//#			(see simple_oled_config.h: SIMPLE_OLED_TX_QUEUE_SIZE)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.09	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	Clear() clears all pages in one pass instead of calling ClearLine()
+//#			for every line, optional blanking of the display while clearing
+//#			(see simple_oled_config.h: SIMPLE_OLED_BLANK_ON_CLEAR)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.08	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	fill every data transmission up to the size of the transmit buffer
+//#			of the Wire library of the platform, also in ClearLine()
+//#			(see simple_oled_config.h: SIMPLE_OLED_WIRE_BUFFER_SIZE)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.07	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	add an optional framebuffer with dirty column tracking per page
+//#			and the functions Flush() and SetAutoFlush()
+//#			(see simple_oled_config.h: SIMPLE_OLED_FRAMEBUFFER)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.06	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	keep a copy of the text shown on the display (text shadow)
+//#			and transmit only characters that have changed
+//#			(see simple_oled_config.h: SIMPLE_OLED_TEXT_SHADOW)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Version: 1.05	Date: 17.10.2026
+//#
+//#	Implementation:
+//#		-	Print() and PrintLn() collect all characters of a line
+//#			and transmit them in as few I²C transmissions as possible
+//#
+//#-------------------------------------------------------------------------
+//#
 //#	Version: 1.04	Date: 13.12.2022
 //#
 //#	Implementation:
@@ -61,6 +271,12 @@
 //==========================================================================
 
 #include <stdint.h>
+#include <stddef.h>
+#include <Print.h>
+
+#include "simple_oled_config.h"
+#include "simple_oled_font.h"
+#include "simple_oled_transport.h"
 
 
 //==========================================================================
@@ -72,6 +288,184 @@
 #define	DISPLAY_ADDRESS					60
 #define SECOND_DISPLAY_ADDRESS			61
 
+#define SIMPLE_OLED_PAGES				8
+#define SIMPLE_OLED_COLUMNS				132
+#define SIMPLE_OLED_VISIBLE_COLUMNS		128
+
+//----	text lines and columns of the selected font (simple_oled_font.h)  --
+#define SIMPLE_OLED_TEXT_LINES			(SIMPLE_OLED_PAGES / gc_usCellPages)
+#define SIMPLE_OLED_TEXT_COLUMNS		(SIMPLE_OLED_VISIBLE_COLUMNS / gc_usCellWidth)
+
+#define SIMPLE_OLED_STREAM_COMMANDS		16
+
+#define SIMPLE_OLED_SCROLL_STEP_MILLIS	10
+
+//----	Size of the transmit buffer of the Wire library  -------------------
+//	The size depends on the platform. All data transmissions are filled
+//	up to this size, so the number of transmissions will be as small as
+//	possible. If the platform is unknown then the size that is defined by
+//	the Wire library is used or at least the 32 bytes of the AVR platform.
+//	SPI and software I²C have no buffer, there the size is only limited
+//	by the counter of the bytes in the transmission.
+//	The size includes the control bytes (prefixes) of the transmission.
+//
+#if SIMPLE_OLED_TRANSPORT != SIMPLE_OLED_TRANSPORT_WIRE
+#define SIMPLE_OLED_I2C_BUFFER_SIZE		256
+#elif 0 < SIMPLE_OLED_WIRE_BUFFER_SIZE
+#define SIMPLE_OLED_I2C_BUFFER_SIZE		SIMPLE_OLED_WIRE_BUFFER_SIZE
+#elif defined( ARDUINO_ARCH_AVR ) || defined( ARDUINO_ARCH_SAM )
+#define SIMPLE_OLED_I2C_BUFFER_SIZE		32
+#elif defined( ARDUINO_ARCH_NRF52 )
+#define SIMPLE_OLED_I2C_BUFFER_SIZE		64
+#elif defined( ARDUINO_ARCH_MEGAAVR )
+#define SIMPLE_OLED_I2C_BUFFER_SIZE		128
+#elif		defined( ARDUINO_ARCH_SAMD )	\
+		||	defined( ARDUINO_ARCH_MBED )	\
+		||	defined( ARDUINO_ARCH_RP2040 )
+#define SIMPLE_OLED_I2C_BUFFER_SIZE		256
+#elif defined( BUFFER_LENGTH )
+#define SIMPLE_OLED_I2C_BUFFER_SIZE		BUFFER_LENGTH
+#else
+#define SIMPLE_OLED_I2C_BUFFER_SIZE		32
+#endif
+
+#if 256 < SIMPLE_OLED_I2C_BUFFER_SIZE
+#undef	SIMPLE_OLED_I2C_BUFFER_SIZE
+#define SIMPLE_OLED_I2C_BUFFER_SIZE		256
+#endif
+
+//----	Read back of the display RAM (see WriteBits())  --------------------
+//	without framebuffer the other pixels of a byte that a graphic covers
+//	only partly are read from the display, the 4-wire SPI interface can
+//	not read the display RAM
+//
+#if !SIMPLE_OLED_FRAMEBUFFER && (SIMPLE_OLED_TRANSPORT != SIMPLE_OLED_TRANSPORT_SPI)
+#define SIMPLE_OLED_READ_BACK			1
+#else
+#define SIMPLE_OLED_READ_BACK			0
+#endif
+
+//----	Bytes of the display RAM that are read back in one read  ----------
+//	the read gets a dummy byte in front of the bytes, the receive buffer
+//	of the Wire library is as big as its transmit buffer, software I²C
+//	has no buffer and reads as much as the AVR platform
+//
+#if SIMPLE_OLED_TRANSPORT != SIMPLE_OLED_TRANSPORT_WIRE
+#define SIMPLE_OLED_READ_BACK_BYTES		31
+#elif (SIMPLE_OLED_I2C_BUFFER_SIZE - 1) < SIMPLE_OLED_COLUMNS
+#define SIMPLE_OLED_READ_BACK_BYTES		(SIMPLE_OLED_I2C_BUFFER_SIZE - 1)
+#else
+#define SIMPLE_OLED_READ_BACK_BYTES		SIMPLE_OLED_COLUMNS
+#endif
+
+//----	Format of labels and fields of a layout  ---------------------------
+#define SIMPLE_OLED_ALIGN_LEFT			0x00
+#define SIMPLE_OLED_ALIGN_RIGHT			0x01
+#define SIMPLE_OLED_ALIGN_CENTER		0x02
+#define SIMPLE_OLED_ALIGN_MASK			0x03
+#define SIMPLE_OLED_INVERSE				0x80
+
+
+//----	groups of public functions for the statistics (see GetStats())  --
+#define SIMPLE_OLED_API_INIT			0	//	Init()
+#define SIMPLE_OLED_API_PRINT			1	//	PrintChar(), write(), Print(), PrintLn()
+#define SIMPLE_OLED_API_FIELD			2	//	PrintNumber(), PrintFixed(), ShowLayout(), SetField(), SetFieldNumber()
+#define SIMPLE_OLED_API_CLEAR			3	//	Clear(), ClearLine()
+#define SIMPLE_OLED_API_CURSOR			4	//	SetCursor(), Home()
+#define SIMPLE_OLED_API_GRAPHICS		5	//	DrawPixel(), DrawHLine(), ... DrawColumn()
+#define SIMPLE_OLED_API_DISPLAY			6	//	SetInverse(), Flip(), SetDisplayColumnOffset(), SetScrollRegion()
+#define SIMPLE_OLED_API_FLUSH			7	//	Flush(), SetRefreshRate()
+#define SIMPLE_OLED_API_UPDATE			8	//	Update(), WaitIdle(), SetAsync()
+#define SIMPLE_OLED_API_COUNT			9
+
+//----	events of the trace (see DumpTrace())  -----------------------------
+#define SIMPLE_OLED_TRACE_API_BEGIN		1	//	value: group SIMPLE_OLED_API_xxx
+#define SIMPLE_OLED_TRACE_API_END		2	//	value: group SIMPLE_OLED_API_xxx
+#define SIMPLE_OLED_TRACE_TX_BEGIN		3	//	value: 0
+#define SIMPLE_OLED_TRACE_TX_END		4	//	value: bytes of the transmission (max. 255)
+#define SIMPLE_OLED_TRACE_TX_ERROR		5	//	value: error code of the transport
+#define SIMPLE_OLED_TRACE_GAP			6	//	value: 0, time in ms instead of µs
+#define SIMPLE_OLED_TRACE_RETRY			7	//	value: number of the repetition
+#define SIMPLE_OLED_TRACE_OFFLINE		8	//	value: error code of the transport
+#define SIMPLE_OLED_TRACE_RECOVER		9	//	value: SIMPLE_OLED_RECOVER_xxx
+
+//----	Clocks of the I²C bus (see AutoTuneClock())  -----------------------
+#define SIMPLE_OLED_CLOCK_STANDARD		100000UL
+#define SIMPLE_OLED_CLOCK_FAST			400000UL
+#define SIMPLE_OLED_CLOCK_FAST_PLUS		1000000UL
+
+//----	cause of a recovery of the display (see IsOnline())  ---------------
+#define SIMPLE_OLED_RECOVER_FOUND		0	//	the offline display answers again
+#define SIMPLE_OLED_RECOVER_RESET		1	//	the display was reset (display off)
+
+
+//--------------------------------------------------------------------------
+//	Layout of a screen (see ShowLayout())
+//
+//	A layout consists of static labels and of fields for values that
+//	change. Labels, fields, the text of the labels and the layout itself
+//	are stored in PROGMEM, e.g.:
+//
+//		const char				g_strSpeed[] PROGMEM	= "Speed:";
+//		const SimpleOledLabel	g_artLabels[] PROGMEM	= { { 2, 0, 0, g_strSpeed } };
+//		const SimpleOledField	g_artFields[] PROGMEM	= { { 2, 7, 5, SIMPLE_OLED_ALIGN_RIGHT } };
+//		const SimpleOledLayout	g_tLayout PROGMEM		= { g_artLabels, 1, g_artFields, 1 };
+//
+typedef struct
+{
+	uint8_t			usTextLine;
+	uint8_t			usTextColumn;
+	uint8_t			usFormat;		//	SIMPLE_OLED_INVERSE or 0
+	const char *	pstrText;		//	text in PROGMEM
+} SimpleOledLabel;
+
+typedef struct
+{
+	uint8_t			usTextLine;
+	uint8_t			usTextColumn;
+	uint8_t			usWidth;
+	uint8_t			usFormat;		//	SIMPLE_OLED_ALIGN_xxx | SIMPLE_OLED_INVERSE
+} SimpleOledField;
+
+typedef struct
+{
+	const SimpleOledLabel *	ptLabels;
+	uint8_t					usLabels;
+	const SimpleOledField *	ptFields;
+	uint8_t					usFields;
+} SimpleOledLayout;
+
+
+//--------------------------------------------------------------------------
+//	Statistics of a display (see GetStats())
+//
+//	Only with SIMPLE_OLED_STATS = 1, otherwise all values are 0.
+//
+typedef struct
+{
+	uint32_t	ulTransactions;		//	transmissions sent to the display
+	uint32_t	ulPayloadBytes;		//	bytes of all transmissions
+	uint32_t	ulAddressBytes;		//	commands to set page and column address
+	uint32_t	ulErrors;			//	transmissions that failed
+	uint32_t	ulBusMicros;		//	time from start to end of the transmissions
+	uint32_t	arulMaxMicros[ SIMPLE_OLED_API_COUNT ];		//	longest call per group SIMPLE_OLED_API_xxx
+} SimpleOledStats;
+
+
+//--------------------------------------------------------------------------
+//	Record of the trace (see DumpTrace())
+//
+//	A time since the previous record of more than 65535 µs is recorded
+//	as an extra record SIMPLE_OLED_TRACE_GAP with the full milliseconds
+//	(max. 65535), the record itself then holds the rest in µs.
+//
+typedef struct
+{
+	uint8_t		usEvent;			//	SIMPLE_OLED_TRACE_xxx
+	uint8_t		usValue;
+	uint16_t	uiDeltaMicros;		//	time since the previous record
+} SimpleOledTraceRecord;
+
 
 //==========================================================================
 //
@@ -83,7 +477,11 @@
 ////////////////////////////////////////////////////////////////////////////
 //	CLASS: SimpleDisplayClass
 //
-class SimpleDisplayClass
+//	The class is derived from the class Print of the Arduino core, so
+//	print() and println() of the Arduino core can be used for numbers,
+//	floats and Printable objects as well.
+//
+class SimpleDisplayClass : public Print
 {
 	public:
 		SimpleDisplayClass();
@@ -95,6 +493,10 @@ class SimpleDisplayClass
 
 		void PrintChar( uint8_t usCharIdx );
 
+		size_t write( uint8_t usData );
+		size_t write( const uint8_t *pusBuffer, size_t uiSize );
+		using ::Print::write;
+
 		void Print(   const __FlashStringHelper* cstrText );
 		void PrintLn( const __FlashStringHelper* cstrText );
 
@@ -112,6 +514,35 @@ class SimpleDisplayClass
 		};
 
 
+		void PrintNumber( uint8_t usTextLine, uint8_t usTextColumn, uint8_t usWidth, int32_t lValue );
+		void PrintFixed(  uint8_t usTextLine, uint8_t usTextColumn, uint8_t usWidth, int32_t lValue, uint8_t usDecimals );
+
+		void ShowLayout( const SimpleOledLayout *ptLayout );
+		void SetField( uint8_t usField, const char *strText );
+		void SetField( uint8_t usField, const __FlashStringHelper *cstrText );
+		void SetFieldNumber( uint8_t usField, int32_t lValue, uint8_t usDecimals = 0 );
+
+		inline void DrawPixel( uint8_t usX, uint8_t usY, bool bOn = true )
+		{
+			FillRect( usX, usY, 1, 1, bOn );
+		};
+
+		inline void DrawHLine( uint8_t usX, uint8_t usY, uint8_t usWidth, bool bOn = true )
+		{
+			FillRect( usX, usY, usWidth, 1, bOn );
+		};
+
+		inline void DrawVLine( uint8_t usX, uint8_t usY, uint8_t usHeight, bool bOn = true )
+		{
+			FillRect( usX, usY, 1, usHeight, bOn );
+		};
+
+		void DrawRect(   uint8_t usX, uint8_t usY, uint8_t usWidth, uint8_t usHeight, bool bOn = true );
+		void FillRect(   uint8_t usX, uint8_t usY, uint8_t usWidth, uint8_t usHeight, bool bOn = true );
+		void DrawBitmap( uint8_t usX, uint8_t usY, uint8_t usWidth, uint8_t usHeight, const uint8_t *pusBitmap );
+		void DrawColumn( uint8_t usX, uint8_t usY, uint8_t usHeight, uint8_t usFirstRow, uint8_t usLastRow );
+
+
 		void Clear( void );
 		void ClearLine( uint8_t usLineToClear );
 		inline void ClearLine( void )
@@ -137,22 +568,189 @@ class SimpleDisplayClass
 		void SetPrintModeOverwriteSameLine( void );
 		void SetPrintModeOverwriteNextLine( void );
 		void SetPrintModeScrollLine( void );
+		void SetScrollRegion( uint8_t usFirstLine, uint8_t usLastLine );
+
+		void SetSmoothScroll( bool bSmooth, uint8_t usStepMillis = SIMPLE_OLED_SCROLL_STEP_MILLIS );
+		bool IsScrolling( void );
 
 		void SetDisplayColumnOffset( uint8_t usOffset );
 
+		void Flush( void );
+		void SetAutoFlush( bool bAutoFlush );
+		void SetRefreshRate( uint8_t usFramesPerSecond );
+
+		void SetAsync( bool bAsync );
+		bool Update( uint8_t usMaxTransmissions = 1 );
+		void WaitIdle( void );
+		uint16_t QueueHighWater( void );
+		bool IsIdle( void );
+
+		void GetStats( SimpleOledStats *ptStats );
+		void ResetStats( void );
+
+		void DumpTrace( ::Print &clOutput );
+		void ClearTrace( void );
+
+		void SetBusClock( uint32_t ulClock );
+		uint32_t AutoTuneClock( uint32_t ulMaxClock = SIMPLE_OLED_CLOCK_FAST_PLUS );
+
+		void SetRecovery( uint8_t usRetries, uint8_t usMaxBlockMillis = SIMPLE_OLED_MAX_BLOCK_MILLIS );
+		bool IsOnline( void );
+		uint16_t RecoveryCount( void );
+
+		inline SimpleOledTransport & Transport( void )
+		{
+			return( m_clTransport );
+		};
+
 
 	private:
+		class ApiCall;
+
+		SimpleOledTransport	m_clTransport;
+
 		uint8_t		m_usAddress;
+		uint8_t		m_usColumnOffset;
+
+		const SimpleOledLayout *	m_ptLayout;
+
 		uint8_t		m_usTextLine;
 		uint8_t		m_usTextColumn;
 		uint8_t		m_usPrintMode;
 		uint8_t		m_usLineOffset;
+		uint8_t		m_arusStreamCommand[ SIMPLE_OLED_STREAM_COMMANDS ];
+		uint8_t		m_usStreamCommands;
+		uint16_t	m_uiStreamBytes;
+		bool		m_bStreamData;
+		uint8_t		m_usRamPage;
+		uint8_t		m_usRamColumn;
 		bool		m_bInverse;
-
+		bool		m_bPositionValid;
+		uint8_t		m_usScrollFirst;
+		uint8_t		m_usScrollLast;
+		bool		m_bSmoothScroll;
+		uint8_t		m_usScrollStepMillis;
+		uint8_t		m_usScrollRow;
+		uint16_t	m_uiScrollStepTime;
+
+#if SIMPLE_OLED_TEXT_SHADOW
+		uint8_t		m_arusTextShadow[ SIMPLE_OLED_TEXT_LINES * SIMPLE_OLED_TEXT_COLUMNS ];
+#endif
+
+#if 1 < SIMPLE_OLED_CELL_PAGES
+		uint8_t		m_arusGlyphRun[ SIMPLE_OLED_TEXT_COLUMNS ];
+		uint8_t		m_usRunLength;
+		uint8_t		m_usRunLine;
+		uint8_t		m_usRunColumn;
+
+		void WriteGlyphRun( void );
+#endif
+
+#if SIMPLE_OLED_FRAMEBUFFER
+		uint8_t		m_arusFrame[ SIMPLE_OLED_PAGES ][ SIMPLE_OLED_COLUMNS ];
+		uint8_t		m_arusDirtyFirst[ SIMPLE_OLED_PAGES ];
+		uint8_t		m_arusDirtyLast[ SIMPLE_OLED_PAGES ];
+		uint8_t		m_usWritePage;
+		uint8_t		m_usWriteColumn;
+		bool		m_bAutoFlush;
+		uint16_t	m_uiFrameMillis;
+		uint16_t	m_uiFrameTime;
+
+		bool IsFrameDirty( void );
+#endif
+
+#if SIMPLE_OLED_READ_BACK
+		uint8_t		m_arusReadBack[ SIMPLE_OLED_READ_BACK_BYTES ];
+		uint8_t		m_usReadColumn;
+		uint8_t		m_usReadBytes;
+		uint8_t		m_usSpanEnd;
+
+		void ReadSpan( void );
+#endif
+
+#if SIMPLE_OLED_STATS
+		SimpleOledStats	m_tStats;
+		uint32_t		m_ulBusStart;
+#endif
+
+#if SIMPLE_OLED_TRACE_SIZE
+		SimpleOledTraceRecord	m_artTrace[ SIMPLE_OLED_TRACE_SIZE ];
+		uint16_t				m_uiTraceNext;
+		uint16_t				m_uiTraceRecords;
+		uint32_t				m_ulTraceTime;
+		uint16_t				m_uiTraceBytes;
+
+		void Trace( uint8_t usEvent, uint8_t usValue );
+#endif
+
+#if SIMPLE_OLED_RECOVERY
+		uint8_t		m_arusRetry[ SIMPLE_OLED_I2C_BUFFER_SIZE ];
+		uint16_t	m_uiRetryBytes;
+		uint8_t		m_usRetries;
+		uint8_t		m_usMaxBlockMillis;
+		uint32_t	m_ulRetryMicros;
+		uint8_t		m_usApiDepth;
+		uint8_t		m_usLink;
+		uint16_t	m_uiLinkTime;
+		uint16_t	m_uiRecoveries;
+		bool		m_bFlip;
+		bool		m_bInverseDisplay;
+
+		void RetryTransmission( uint8_t usError );
+		void CheckLink( void );
+		void Recover( uint8_t usCause );
+#endif
+
+#if SIMPLE_OLED_TX_QUEUE_SIZE
+		uint8_t		m_arusQueue[ SIMPLE_OLED_TX_QUEUE_SIZE ];
+		uint16_t	m_uiQueueHead;
+		uint16_t	m_uiQueueTail;
+		uint16_t	m_uiQueueUsed;
+		uint16_t	m_uiQueueHighWater;
+		uint16_t	m_uiQueueRecord;
+		uint16_t	m_uiQueueWrite;
+		uint16_t	m_uiRecordBytes;
+		bool		m_bAsync;
+
+		void SendQueued( void );
+		uint16_t QueueNext( uint16_t uiIdx );
+#endif
+
+		void WriteGlyph( uint8_t usCharIdx );
+		void WriteGlyphPage( uint8_t usCell, uint8_t usCharPage );
+		void WriteData( uint8_t usData );
+		void EndData( void );
+		void SetWritePosition( uint8_t usPage, uint8_t usColumn );
+		void SendPosition( uint8_t usPage, uint8_t usColumn );
+		void StreamCommand( uint8_t usCommand );
+		void StreamData( uint8_t usData );
+		void EndStream( void );
+		void BusBegin( void );
+		void BusWrite( uint8_t usData );
+		void BusWrite( const uint8_t *pusData, uint8_t usLength );
+		void BusEnd( void );
+		void TransportBegin( void );
+		void TransportWrite( uint8_t usData );
+		void TransportEnd( void );
+		bool CheckClock( void );
+		void FormatFixed( char *pcField, uint8_t usWidth, int32_t lValue, uint8_t usDecimals );
+		bool ReadField( uint8_t usField, SimpleOledField *ptField );
+		void WriteField( uint8_t usField, const char *pcText, uint8_t usLength );
+		void InvalidateTextShadow( void );
+		void ReplayContent( void );
+		void InvalidateTextCells( uint8_t usPage, uint8_t usX, uint8_t usWidth );
+		bool ClipArea( uint8_t usX, uint8_t usY, uint8_t *pusWidth, uint8_t *pusHeight );
+		void FillArea( uint8_t usX, uint8_t usY, uint8_t usWidth, uint8_t usHeight, bool bOn );
+		uint8_t RowMask( uint8_t usRow, uint8_t usEndRow );
+		void SetGraphicPosition( uint8_t usRow, uint8_t usX, uint8_t usWidth );
+		void WriteBits( uint8_t usMask, uint8_t usBits );
+		uint8_t DisplayLine( uint8_t usTextLine );
 		void NextLine( bool bShiftLine );
 		void SendCommand( uint8_t usOpCode );
 		void SendCommand( uint8_t usOpCode, uint8_t usParameter );
 		void ShiftDisplayOneLine( void );
+		void FinishScroll( void );
+		void ScrollRegion( void );
 };
 
 
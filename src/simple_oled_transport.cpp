@@ -0,0 +1,601 @@
+//##########################################################################
+//#
+//#		simple_oled_transport.cpp
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Implementation of the transport classes that are too big to be
+//#	inline functions (see simple_oled_transport.h).
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include "simple_oled_transport.h"
+
+
+#if SIMPLE_OLED_TRANSPORT != SIMPLE_OLED_TRANSPORT_SPI
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+//----	Error codes like the Wire library  ---------------------------------
+#define ERROR_NONE						0
+#define ERROR_NACK_ADDRESS				2
+#define ERROR_NACK_DATA					3
+#define ERROR_OTHER						4
+#define ERROR_TIMEOUT					5
+
+//----	Maximum time a slave may stretch the clock (in half periods)  ------
+//	used if no timeout is set (see SetTimeout())
+//
+#define CLOCK_STRETCH_MAX				100
+
+//----	Bus clear  ---------------------------------------------------------
+//	a slave that holds SDA low gets up to 9 clock pulses to finish its
+//	byte, the Wire library does not tell its clock, so the pulses of the
+//	hardware I²C bus have about 100 kHz
+//
+#define CLEAR_BUS_PULSES				9
+#define WIRE_CLEAR_HALF_PERIOD			5
+
+//----	Control byte in front of a read: command or data, last byte  -----
+//	the command form reads the status byte, the data form the display RAM
+//
+#define CONTROL_COMMAND					0x00
+#define CONTROL_DATA					SIMPLE_OLED_CONTROL_DATA
+
+//----	Bytes in front of a read of the display RAM  ----------------------
+//	the first byte after the address is set is a dummy byte
+//
+#define READ_DUMMY_BYTES				1
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+//**************************************************************************
+//	SimpleOledClearBus
+//--------------------------------------------------------------------------
+//	The function frees a bus whose SDA line is held low by a slave that
+//	lost some clock pulses (e.g. after a reset of the master within a
+//	transmission): it clocks SCL until the slave releases SDA and sends
+//	a STOP condition. The lines are driven like open drain outputs.
+//	Returns 'true' if both lines are high afterwards.
+//
+bool SimpleOledClearBus( uint8_t usPinSDA, uint8_t usPinSCL, uint8_t usHalfPeriod )
+{
+	if( (SIMPLE_OLED_NO_PIN == usPinSDA) || (SIMPLE_OLED_NO_PIN == usPinSCL) )
+	{
+		return( false );
+	}
+
+	digitalWrite( usPinSDA, LOW );
+	digitalWrite( usPinSCL, LOW );
+	pinMode( usPinSDA, INPUT );
+	pinMode( usPinSCL, INPUT );
+	delayMicroseconds( usHalfPeriod );
+
+	for( uint8_t idx = 0 ; (idx < CLEAR_BUS_PULSES) && (LOW == digitalRead( usPinSDA )) ; idx++ )
+	{
+		pinMode( usPinSCL, OUTPUT );
+		delayMicroseconds( usHalfPeriod );
+		pinMode( usPinSCL, INPUT );
+		delayMicroseconds( usHalfPeriod );
+	}
+
+	//----------------------------------------------------------------------
+	//	STOP: SDA goes high while SCL is high
+	//
+	pinMode( usPinSDA, OUTPUT );
+	delayMicroseconds( usHalfPeriod );
+	pinMode( usPinSDA, INPUT );
+	delayMicroseconds( usHalfPeriod );
+
+	return( (HIGH == digitalRead( usPinSDA )) && (HIGH == digitalRead( usPinSCL )) );
+}
+
+#endif
+
+
+#if SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_WIRE
+
+////////////////////////////////////////////////////////////////////////////
+//
+//	CLASS: SimpleOledWireTransport
+//
+
+
+//**************************************************************************
+//	ClearBus
+//--------------------------------------------------------------------------
+//	Stops the Wire library, frees the bus on the pins of the bus (see
+//	SetBusPins()) and starts the Wire library again.
+//	Without known pins only the Wire library is started again.
+//
+bool SimpleOledWireTransport::ClearBus( void )
+{
+	bool	bFree;
+
+	m_pclWire->end();
+
+	bFree = SimpleOledClearBus( m_usPinSDA, m_usPinSCL, WIRE_CLEAR_HALF_PERIOD );
+
+	Begin();
+
+	return( bFree );
+}
+
+
+//**************************************************************************
+//	ReadStatus
+//--------------------------------------------------------------------------
+//	Sends the control byte for commands and reads the status byte of the
+//	display after a repeated START.
+//
+uint8_t SimpleOledWireTransport::ReadStatus( uint8_t usAddress, uint8_t *pusStatus )
+{
+	return( Read( usAddress, CONTROL_COMMAND, pusStatus, 1, 0 ) );
+}
+
+
+//**************************************************************************
+//	ReadData
+//--------------------------------------------------------------------------
+//	Sends the control byte for data and reads usCount bytes of the display
+//	RAM after a repeated START, the dummy byte in front of them is
+//	skipped.
+//
+uint8_t SimpleOledWireTransport::ReadData( uint8_t usAddress, uint8_t *pusData, uint8_t usCount )
+{
+	return( Read( usAddress, CONTROL_DATA, pusData, usCount, READ_DUMMY_BYTES ) );
+}
+
+
+//**************************************************************************
+//	Read (private)
+//--------------------------------------------------------------------------
+//	Sends the control byte usControl and reads usSkip + usCount bytes
+//	after a repeated START, the first usSkip bytes are dropped.
+//
+uint8_t SimpleOledWireTransport::Read( uint8_t usAddress, uint8_t usControl, uint8_t *pusData, uint8_t usCount, uint8_t usSkip )
+{
+	uint8_t	usError;
+	uint8_t	usQuantity = usSkip + usCount;
+
+	m_pclWire->beginTransmission( usAddress );
+	m_pclWire->write( usControl );
+
+	usError = m_pclWire->endTransmission( false );
+
+	if( ERROR_NONE != usError )
+	{
+		return( usError );
+	}
+
+	if( usQuantity != m_pclWire->requestFrom( usAddress, usQuantity ) )
+	{
+		return( ERROR_OTHER );
+	}
+
+	while( 0 < usSkip-- )
+	{
+		m_pclWire->read();
+	}
+
+	while( 0 < usCount-- )
+	{
+		*pusData++ = (uint8_t)m_pclWire->read();
+	}
+
+	return( ERROR_NONE );
+}
+
+#endif
+
+
+#if SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_SOFT_I2C
+
+////////////////////////////////////////////////////////////////////////////
+//
+//	CLASS: SimpleOledSoftI2cTransport
+//
+
+
+//**************************************************************************
+//	Constructor
+//--------------------------------------------------------------------------
+//
+SimpleOledSoftI2cTransport::SimpleOledSoftI2cTransport()
+{
+	m_usPinSDA		= SIMPLE_OLED_SOFT_I2C_PIN_SDA;
+	m_usPinSCL		= SIMPLE_OLED_SOFT_I2C_PIN_SCL;
+	m_usError		= ERROR_NONE;
+	m_ulTimeout		= SIMPLE_OLED_BUS_TIMEOUT_MICROS;
+
+	SetClock( SIMPLE_OLED_SOFT_I2C_CLOCK );
+}
+
+
+//**************************************************************************
+//	SetPins
+//--------------------------------------------------------------------------
+//	Sets the pins for SDA and SCL. Must be called before Init().
+//
+void SimpleOledSoftI2cTransport::SetPins( uint8_t usPinSDA, uint8_t usPinSCL )
+{
+	m_usPinSDA	= usPinSDA;
+	m_usPinSCL	= usPinSCL;
+}
+
+
+//**************************************************************************
+//	SetClock
+//--------------------------------------------------------------------------
+//	Sets the clock of the bus. The real clock will be lower because of
+//	the time that is needed by digitalWrite() and pinMode().
+//	'0' selects SIMPLE_OLED_SOFT_I2C_CLOCK.
+//
+void SimpleOledSoftI2cTransport::SetClock( uint32_t ulClock )
+{
+	uint32_t	ulHalfPeriod;
+
+	if( 0 == ulClock )
+	{
+		ulClock = SIMPLE_OLED_SOFT_I2C_CLOCK;
+	}
+
+	ulHalfPeriod = 500000UL / ulClock;
+
+	m_ulClock		= ulClock;
+	m_usHalfPeriod = (255 < ulHalfPeriod) ? 255 : (uint8_t)ulHalfPeriod;
+
+	SetTimeout( m_ulTimeout );
+}
+
+
+//**************************************************************************
+//	SetTimeout
+//--------------------------------------------------------------------------
+//	Sets the longest time a slave may stretch the clock, '0' selects
+//	CLOCK_STRETCH_MAX half periods of the clock.
+//
+void SimpleOledSoftI2cTransport::SetTimeout( uint32_t ulMicros )
+{
+	uint32_t	ulHalfPeriods = ulMicros / ((0 < m_usHalfPeriod) ? m_usHalfPeriod : 1);
+
+	m_ulTimeout = ulMicros;
+
+	if( 0 == ulMicros )
+	{
+		ulHalfPeriods = CLOCK_STRETCH_MAX;
+	}
+
+	m_uiStretchMax = (0xFFFF < ulHalfPeriods) ? 0xFFFF : ((0 == ulHalfPeriods) ? 1 : (uint16_t)ulHalfPeriods);
+}
+
+
+//**************************************************************************
+//	Begin
+//--------------------------------------------------------------------------
+//	Releases both lines of the bus (idle state).
+//
+void SimpleOledSoftI2cTransport::Begin( void )
+{
+	digitalWrite( m_usPinSDA, LOW );
+	digitalWrite( m_usPinSCL, LOW );
+
+	Release( m_usPinSDA );
+	Release( m_usPinSCL );
+}
+
+
+//**************************************************************************
+//	Probe
+//--------------------------------------------------------------------------
+//	Sends just the address and returns '0' if the display acknowledges it.
+//
+uint8_t SimpleOledSoftI2cTransport::Probe( uint8_t usAddress )
+{
+	BeginTransmission( usAddress );
+
+	return( EndTransmission() );
+}
+
+
+//**************************************************************************
+//	BeginTransmission
+//--------------------------------------------------------------------------
+//	Sends the START condition and the address byte (write).
+//
+void SimpleOledSoftI2cTransport::BeginTransmission( uint8_t usAddress )
+{
+	m_usError = ERROR_NONE;
+
+	Start();
+
+	if( !WriteByte( usAddress << 1 ) && (ERROR_NONE == m_usError) )
+	{
+		m_usError = ERROR_NACK_ADDRESS;
+	}
+}
+
+
+//**************************************************************************
+//	Write
+//--------------------------------------------------------------------------
+//	Sends one byte. After an error the rest of the transmission is
+//	skipped.
+//
+void SimpleOledSoftI2cTransport::Write( uint8_t usData )
+{
+	if( ERROR_NONE == m_usError )
+	{
+		if( !WriteByte( usData ) && (ERROR_NONE == m_usError) )
+		{
+			m_usError = ERROR_NACK_DATA;
+		}
+	}
+}
+
+
+//**************************************************************************
+//	EndTransmission
+//--------------------------------------------------------------------------
+//	Sends the STOP condition and returns the error of the transmission.
+//
+uint8_t SimpleOledSoftI2cTransport::EndTransmission( void )
+{
+	//----------------------------------------------------------------------
+	//	STOP: SDA goes high while SCL is high
+	//
+	DriveLow( m_usPinSDA );
+	delayMicroseconds( m_usHalfPeriod );
+	ReleaseClock();
+	delayMicroseconds( m_usHalfPeriod );
+	Release( m_usPinSDA );
+	delayMicroseconds( m_usHalfPeriod );
+
+	return( m_usError );
+}
+
+
+//**************************************************************************
+//	ClearBus
+//--------------------------------------------------------------------------
+//	Frees the bus if a slave holds SDA low (see SimpleOledClearBus()).
+//
+bool SimpleOledSoftI2cTransport::ClearBus( void )
+{
+	return( SimpleOledClearBus( m_usPinSDA, m_usPinSCL, m_usHalfPeriod ) );
+}
+
+
+//**************************************************************************
+//	ReadStatus
+//--------------------------------------------------------------------------
+//	Sends the control byte for commands and reads the status byte of the
+//	display after a repeated START.
+//
+uint8_t SimpleOledSoftI2cTransport::ReadStatus( uint8_t usAddress, uint8_t *pusStatus )
+{
+	return( Read( usAddress, CONTROL_COMMAND, pusStatus, 1, 0 ) );
+}
+
+
+//**************************************************************************
+//	ReadData
+//--------------------------------------------------------------------------
+//	Sends the control byte for data and reads usCount bytes of the display
+//	RAM after a repeated START, the dummy byte in front of them is
+//	skipped.
+//
+uint8_t SimpleOledSoftI2cTransport::ReadData( uint8_t usAddress, uint8_t *pusData, uint8_t usCount )
+{
+	return( Read( usAddress, CONTROL_DATA, pusData, usCount, READ_DUMMY_BYTES ) );
+}
+
+
+//**************************************************************************
+//	Read (private)
+//--------------------------------------------------------------------------
+//	Sends the control byte usControl and reads usSkip + usCount bytes
+//	after a repeated START, the first usSkip bytes are dropped.
+//
+uint8_t SimpleOledSoftI2cTransport::Read( uint8_t usAddress, uint8_t usControl, uint8_t *pusData, uint8_t usCount, uint8_t usSkip )
+{
+	BeginTransmission( usAddress );
+	Write( usControl );
+
+	if( ERROR_NONE == m_usError )
+	{
+		//------------------------------------------------------------------
+		//	repeated START: release SDA and SCL, then START
+		//
+		Release( m_usPinSDA );
+		delayMicroseconds( m_usHalfPeriod );
+		ReleaseClock();
+		delayMicroseconds( m_usHalfPeriod );
+		Start();
+
+		if( !WriteByte( (usAddress << 1) | 0x01 ) && (ERROR_NONE == m_usError) )
+		{
+			m_usError = ERROR_NACK_ADDRESS;
+		}
+
+		while( (ERROR_NONE == m_usError) && (0 < usSkip) )
+		{
+			usSkip--;
+			ReadByte( false );
+		}
+
+		while( (ERROR_NONE == m_usError) && (0 < usCount) )
+		{
+			usCount--;
+			*pusData++ = ReadByte( 0 == usCount );
+		}
+	}
+
+	return( EndTransmission() );
+}
+
+
+//**************************************************************************
+//	Start (private)
+//--------------------------------------------------------------------------
+//	Sends the START condition: SDA goes low while SCL is high.
+//
+void SimpleOledSoftI2cTransport::Start( void )
+{
+	DriveLow( m_usPinSDA );
+	delayMicroseconds( m_usHalfPeriod );
+	DriveLow( m_usPinSCL );
+}
+
+
+//**************************************************************************
+//	WriteByte (private)
+//--------------------------------------------------------------------------
+//	Sends 8 bits (MSB first) and reads the acknowledge bit.
+//	Returns 'true' if the slave acknowledged the byte.
+//
+bool SimpleOledSoftI2cTransport::WriteByte( uint8_t usData )
+{
+	bool	bAck;
+
+	for( uint8_t usMask = 0x80 ; 0 != usMask ; usMask >>= 1 )
+	{
+		if( usData & usMask )
+		{
+			Release( m_usPinSDA );
+		}
+		else
+		{
+			DriveLow( m_usPinSDA );
+		}
+
+		delayMicroseconds( m_usHalfPeriod );
+		ReleaseClock();
+		delayMicroseconds( m_usHalfPeriod );
+		DriveLow( m_usPinSCL );
+	}
+
+	//----------------------------------------------------------------------
+	//	the slave pulls SDA low to acknowledge the byte
+	//
+	Release( m_usPinSDA );
+	delayMicroseconds( m_usHalfPeriod );
+	ReleaseClock();
+	delayMicroseconds( m_usHalfPeriod );
+
+	bAck = (LOW == digitalRead( m_usPinSDA ));
+
+	DriveLow( m_usPinSCL );
+
+	if( ERROR_TIMEOUT == m_usError )
+	{
+		return( false );
+	}
+
+	return( bAck );
+}
+
+
+//**************************************************************************
+//	ReadByte (private)
+//--------------------------------------------------------------------------
+//	Reads 8 bits (MSB first) and answers with ACK, so the slave sends the
+//	next byte, or with NACK for the last byte, so the slave stops sending.
+//
+uint8_t SimpleOledSoftI2cTransport::ReadByte( bool bLast )
+{
+	uint8_t	usData = 0;
+
+	Release( m_usPinSDA );
+
+	for( uint8_t idx = 0 ; idx < 8 ; idx++ )
+	{
+		delayMicroseconds( m_usHalfPeriod );
+		ReleaseClock();
+		delayMicroseconds( m_usHalfPeriod );
+
+		usData = (usData << 1) | ((HIGH == digitalRead( m_usPinSDA )) ? 1 : 0);
+
+		DriveLow( m_usPinSCL );
+	}
+
+	//----------------------------------------------------------------------
+	//	ACK: SDA is low during the ninth clock, NACK: SDA stays high
+	//
+	if( !bLast )
+	{
+		DriveLow( m_usPinSDA );
+	}
+
+	delayMicroseconds( m_usHalfPeriod );
+	ReleaseClock();
+	delayMicroseconds( m_usHalfPeriod );
+	DriveLow( m_usPinSCL );
+	Release( m_usPinSDA );
+
+	return( usData );
+}
+
+
+//**************************************************************************
+//	Release (private)
+//--------------------------------------------------------------------------
+//	The pin gets high by the pull up resistor.
+//
+void SimpleOledSoftI2cTransport::Release( uint8_t usPin )
+{
+	pinMode( usPin, INPUT );
+}
+
+
+//**************************************************************************
+//	DriveLow (private)
+//--------------------------------------------------------------------------
+//	The output latch of the pin is always LOW (see Begin()),
+//	so switching to output drives the pin low.
+//
+void SimpleOledSoftI2cTransport::DriveLow( uint8_t usPin )
+{
+	pinMode( usPin, OUTPUT );
+}
+
+
+//**************************************************************************
+//	ReleaseClock (private)
+//--------------------------------------------------------------------------
+//	Releases SCL and waits while the slave holds it low (clock
+//	stretching), but not longer than the timeout (see SetTimeout()).
+//
+void SimpleOledSoftI2cTransport::ReleaseClock( void )
+{
+	Release( m_usPinSCL );
+
+	for( uint16_t idx = 0 ; LOW == digitalRead( m_usPinSCL ) ; idx++ )
+	{
+		if( m_uiStretchMax <= idx )
+		{
+			m_usError = ERROR_TIMEOUT;
+			return;
+		}
+
+		delayMicroseconds( m_usHalfPeriod );
+	}
+}
+
+#endif
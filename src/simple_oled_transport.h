@@ -0,0 +1,430 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		simple_oled_transport.h
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Transport classes for the communication with the display.
+//#	The transport is selected at compile time with SIMPLE_OLED_TRANSPORT
+//#	(see simple_oled_config.h), the selected class is available as
+//#	'SimpleOledTransport'. There are no virtual functions, so all calls
+//#	are resolved at compile time.
+//#
+//#	Every transport class has the same functions:
+//#		Begin()						initialize the interface
+//#		SetClock( clock )			clock of the bus in Hz
+//#		GetClock()					clock of the bus in Hz ('0' = default
+//#									of the Wire library)
+//#		Probe( address )			check if a display is connected
+//#									('0' if okay, otherwise error code)
+//#		BeginTransmission( address )
+//#		Write( data )
+//#		EndTransmission()			('0' if okay, otherwise error code)
+//#		SetTimeout( micros )		longest time a transmission may wait
+//#									for the bus ('0' = default)
+//#		ClearBus()					free a bus that is held by a slave
+//#									('true' if the bus is free)
+//#		ReadStatus( address, *status )
+//#									read the status byte of the display
+//#									('0' if okay, otherwise error code)
+//#		ReadData( address, *data, count )
+//#									read count bytes of the display RAM
+//#									from the actual position on, the
+//#									column moves with every byte
+//#									('0' if okay, otherwise error code)
+//#
+//#	The class SimpleDisplayClass always creates transmissions in the
+//#	format of the I²C bus: each transmission starts with a control byte
+//#	(PREFIX_xxx) that tells if commands or data will follow. The SPI
+//#	transport converts the control bytes into the level of the D/C pin.
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+
+#include "simple_oled_config.h"
+
+#if SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_WIRE
+#include <Wire.h>
+#elif SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_SPI
+#include <Arduino.h>
+#include <SPI.h>
+#elif SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_SOFT_I2C
+#include <Arduino.h>
+#else
+#error "unknown SIMPLE_OLED_TRANSPORT"
+#endif
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+//----	Bits of the control byte (prefix)  ---------------------------------
+#define SIMPLE_OLED_CONTROL_CONTINUATION	0x80
+#define SIMPLE_OLED_CONTROL_DATA			0x40
+
+#define SIMPLE_OLED_NO_PIN					0xFF
+
+//----	Status byte of the display (see ReadStatus())  ---------------------
+#define SIMPLE_OLED_STATUS_BUSY				0x80
+#define SIMPLE_OLED_STATUS_DISPLAY_OFF		0x40
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+#if SIMPLE_OLED_TRANSPORT != SIMPLE_OLED_TRANSPORT_SPI
+bool SimpleOledClearBus( uint8_t usPinSDA, uint8_t usPinSCL, uint8_t usHalfPeriod );
+#endif
+
+
+//==========================================================================
+//
+//		C L A S S   D E F I N I T I O N S
+//
+//==========================================================================
+
+#if SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_WIRE
+
+////////////////////////////////////////////////////////////////////////////
+//	CLASS: SimpleOledWireTransport
+//
+//	Hardware I²C bus with the Wire library.
+//
+class SimpleOledWireTransport
+{
+	public:
+		SimpleOledWireTransport()
+		{
+			m_pclWire	= &Wire;
+			m_ulClock	= SIMPLE_OLED_WIRE_CLOCK;
+			m_ulTimeout	= SIMPLE_OLED_BUS_TIMEOUT_MICROS;
+
+#if defined( PIN_WIRE_SDA ) && defined( PIN_WIRE_SCL )
+			m_usPinSDA	= PIN_WIRE_SDA;
+			m_usPinSCL	= PIN_WIRE_SCL;
+#else
+			m_usPinSDA	= SIMPLE_OLED_NO_PIN;
+			m_usPinSCL	= SIMPLE_OLED_NO_PIN;
+#endif
+		};
+
+		inline void SetWire( TwoWire &clWire )
+		{
+			m_pclWire = &clWire;
+		};
+
+		//--------------------------------------------------------------
+		//	the pins of the bus are only needed by ClearBus(), the pins
+		//	of 'Wire' are known on most platforms
+		//
+		inline void SetBusPins( uint8_t usPinSDA, uint8_t usPinSCL )
+		{
+			m_usPinSDA	= usPinSDA;
+			m_usPinSCL	= usPinSCL;
+		};
+
+		//--------------------------------------------------------------
+		//	the clock is kept, because begin() of the Wire library
+		//	sets its default clock again, '0' keeps the clock of the
+		//	Wire library
+		//
+		inline void SetClock( uint32_t ulClock )
+		{
+			m_ulClock = ulClock;
+
+			if( 0 < m_ulClock )
+			{
+				m_pclWire->setClock( m_ulClock );
+			}
+		};
+
+		inline uint32_t GetClock( void )
+		{
+			return( m_ulClock );
+		};
+
+		//--------------------------------------------------------------
+		//	only Wire libraries with timeout (WIRE_HAS_TIMEOUT) support
+		//	the timeout, the Wire library is reset after a timeout
+		//
+		inline void SetTimeout( uint32_t ulMicros )
+		{
+			m_ulTimeout = ulMicros;
+
+#if defined( WIRE_HAS_TIMEOUT )
+			if( 0 < m_ulTimeout )
+			{
+				m_pclWire->setWireTimeout( m_ulTimeout, true );
+			}
+#endif
+		};
+
+		inline void Begin( void )
+		{
+			m_pclWire->begin();
+
+			SetClock( m_ulClock );
+			SetTimeout( m_ulTimeout );
+		};
+
+		inline uint8_t Probe( uint8_t usAddress )
+		{
+			m_pclWire->beginTransmission( usAddress );
+
+			return( m_pclWire->endTransmission() );
+		};
+
+		inline void BeginTransmission( uint8_t usAddress )
+		{
+			m_pclWire->beginTransmission( usAddress );
+		};
+
+		inline void Write( uint8_t usData )
+		{
+			m_pclWire->write( usData );
+		};
+
+		inline uint8_t EndTransmission( void )
+		{
+			return( m_pclWire->endTransmission() );
+		};
+
+		bool	ClearBus( void );
+		uint8_t	ReadStatus( uint8_t usAddress, uint8_t *pusStatus );
+		uint8_t	ReadData( uint8_t usAddress, uint8_t *pusData, uint8_t usCount );
+
+	private:
+		TwoWire		*m_pclWire;
+		uint32_t	m_ulClock;
+		uint32_t	m_ulTimeout;
+		uint8_t		m_usPinSDA;
+		uint8_t		m_usPinSCL;
+
+		uint8_t Read( uint8_t usAddress, uint8_t usControl, uint8_t *pusData, uint8_t usCount, uint8_t usSkip );
+};
+
+typedef SimpleOledWireTransport		SimpleOledTransport;
+
+
+#elif SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_SPI
+
+////////////////////////////////////////////////////////////////////////////
+//	CLASS: SimpleOledSpiTransport
+//
+//	4-wire SPI with the SPI library and the pins D/C (data/command),
+//	CS (chip select) and optional RES (reset).
+//	The display must be configured for the 4-wire SPI interface.
+//
+class SimpleOledSpiTransport
+{
+	public:
+		SimpleOledSpiTransport()
+		{
+			m_usPinDC		= SIMPLE_OLED_SPI_PIN_DC;
+			m_usPinCS		= SIMPLE_OLED_SPI_PIN_CS;
+			m_usPinReset	= SIMPLE_OLED_SPI_PIN_RESET;
+			m_ulClock		= SIMPLE_OLED_SPI_CLOCK;
+			m_bExpectControl= true;
+			m_bSingleByte	= false;
+		};
+
+		inline void SetPins( uint8_t usPinDC, uint8_t usPinCS, uint8_t usPinReset = SIMPLE_OLED_NO_PIN )
+		{
+			m_usPinDC		= usPinDC;
+			m_usPinCS		= usPinCS;
+			m_usPinReset	= usPinReset;
+		};
+
+		inline void SetClock( uint32_t ulClock )
+		{
+			m_ulClock = ulClock;
+		};
+
+		inline uint32_t GetClock( void )
+		{
+			return( m_ulClock );
+		};
+
+		inline void Begin( void )
+		{
+			pinMode( m_usPinDC, OUTPUT );
+			pinMode( m_usPinCS, OUTPUT );
+			digitalWrite( m_usPinCS, HIGH );
+
+			if( SIMPLE_OLED_NO_PIN != m_usPinReset )
+			{
+				pinMode( m_usPinReset, OUTPUT );
+				digitalWrite( m_usPinReset, LOW );
+				delayMicroseconds( 10 );
+				digitalWrite( m_usPinReset, HIGH );
+				delayMicroseconds( 10 );
+			}
+
+			SPI.begin();
+		};
+
+		//--------------------------------------------------------------
+		//	there is no acknowledge on the SPI bus
+		//
+		inline uint8_t Probe( uint8_t usAddress )
+		{
+			(void)usAddress;
+
+			return( 0 );
+		};
+
+		inline void BeginTransmission( uint8_t usAddress )
+		{
+			(void)usAddress;
+
+			m_bExpectControl = true;
+
+			SPI.beginTransaction( SPISettings( m_ulClock, MSBFIRST, SPI_MODE0 ) );
+			digitalWrite( m_usPinCS, LOW );
+		};
+
+		//--------------------------------------------------------------
+		//	a control byte sets the D/C pin for the following byte(s),
+		//	all other bytes are sent to the display
+		//
+		inline void Write( uint8_t usData )
+		{
+			if( m_bExpectControl )
+			{
+				digitalWrite( m_usPinDC, (usData & SIMPLE_OLED_CONTROL_DATA) ? HIGH : LOW );
+
+				m_bSingleByte		= (0 != (usData & SIMPLE_OLED_CONTROL_CONTINUATION));
+				m_bExpectControl	= false;
+			}
+			else
+			{
+				SPI.transfer( usData );
+
+				m_bExpectControl = m_bSingleByte;
+			}
+		};
+
+		inline uint8_t EndTransmission( void )
+		{
+			digitalWrite( m_usPinCS, HIGH );
+			SPI.endTransaction();
+
+			return( 0 );
+		};
+
+		//--------------------------------------------------------------
+		//	the SPI bus has no timeout and cannot be blocked by the
+		//	display, the status and the display RAM cannot be read with
+		//	the 4-wire SPI interface, so the display is assumed to be on
+		//	and a read of the display RAM fails
+		//
+		inline void SetTimeout( uint32_t ulMicros )
+		{
+			(void)ulMicros;
+		};
+
+		inline bool ClearBus( void )
+		{
+			return( true );
+		};
+
+		inline uint8_t ReadStatus( uint8_t usAddress, uint8_t *pusStatus )
+		{
+			(void)usAddress;
+
+			*pusStatus = 0;
+
+			return( 0 );
+		};
+
+		inline uint8_t ReadData( uint8_t usAddress, uint8_t *pusData, uint8_t usCount )
+		{
+			(void)usAddress;
+			(void)pusData;
+			(void)usCount;
+
+			return( 4 );
+		};
+
+	private:
+		uint8_t		m_usPinDC;
+		uint8_t		m_usPinCS;
+		uint8_t		m_usPinReset;
+		uint32_t	m_ulClock;
+		bool		m_bExpectControl;
+		bool		m_bSingleByte;
+};
+
+typedef SimpleOledSpiTransport		SimpleOledTransport;
+
+
+#elif SIMPLE_OLED_TRANSPORT == SIMPLE_OLED_TRANSPORT_SOFT_I2C
+
+////////////////////////////////////////////////////////////////////////////
+//	CLASS: SimpleOledSoftI2cTransport
+//
+//	I²C bus on any two pins (bit-banged).
+//	The pins are driven like open drain outputs: 'low' is an output with
+//	level LOW, 'high' is an input, so external pull up resistors are
+//	needed (most display modules have them on board).
+//
+class SimpleOledSoftI2cTransport
+{
+	public:
+		SimpleOledSoftI2cTransport();
+
+		void SetPins( uint8_t usPinSDA, uint8_t usPinSCL );
+		void SetClock( uint32_t ulClock );
+		void SetTimeout( uint32_t ulMicros );
+
+		inline uint32_t GetClock( void )
+		{
+			return( m_ulClock );
+		};
+
+		void	Begin( void );
+		uint8_t	Probe( uint8_t usAddress );
+		void	BeginTransmission( uint8_t usAddress );
+		void	Write( uint8_t usData );
+		uint8_t	EndTransmission( void );
+		bool	ClearBus( void );
+		uint8_t	ReadStatus( uint8_t usAddress, uint8_t *pusStatus );
+		uint8_t	ReadData( uint8_t usAddress, uint8_t *pusData, uint8_t usCount );
+
+	private:
+		uint8_t		m_usPinSDA;
+		uint8_t		m_usPinSCL;
+		uint8_t		m_usHalfPeriod;
+		uint8_t		m_usError;
+		uint32_t	m_ulClock;
+		uint32_t	m_ulTimeout;
+		uint16_t	m_uiStretchMax;
+
+		uint8_t Read( uint8_t usAddress, uint8_t usControl, uint8_t *pusData, uint8_t usCount, uint8_t usSkip );
+		void Start( void );
+		bool WriteByte( uint8_t usData );
+		uint8_t ReadByte( bool bLast );
+		void Release( uint8_t usPin );
+		void DriveLow( uint8_t usPin );
+		void ReleaseClock( void );
+};
+
+typedef SimpleOledSoftI2cTransport	SimpleOledTransport;
+
+#endif
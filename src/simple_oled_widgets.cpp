@@ -0,0 +1,268 @@
+//##########################################################################
+//#
+//#		simple_oled_widgets.cpp
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Implementation of the classes SimpleOledSparkline and
+//#	SimpleOledBarGraph (see simple_oled_widgets.h).
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <Arduino.h>
+
+#include "simple_oled_widgets.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define PIXELS_PAGE_HEIGHT				8
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+//**************************************************************************
+//	ScaleValue
+//--------------------------------------------------------------------------
+//	The function maps iValue from the range iMin to iMax to the range
+//	0 to usSteps. Values outside the range are limited.
+//	The differences are calculated with 32 bits, because 'int' has only
+//	16 bits on AVR (e.g. -20000 to 20000).
+//
+static uint8_t ScaleValue( int16_t iValue, int16_t iMin, int16_t iMax, uint8_t usSteps )
+{
+	if( iValue <= iMin )
+	{
+		return( 0 );
+	}
+
+	if( iValue >= iMax )
+	{
+		return( usSteps );
+	}
+
+	return( (uint8_t)((((int32_t)iValue - iMin) * usSteps) / ((int32_t)iMax - iMin)) );
+}
+
+
+////////////////////////////////////////////////////////////////////////////
+//
+//	CLASS: SimpleOledSparkline
+//
+
+
+//**************************************************************************
+//	Constructor
+//--------------------------------------------------------------------------
+//
+SimpleOledSparkline::SimpleOledSparkline()
+{
+	m_pclDisplay	= NULL;
+	m_usX			= 0;
+	m_usY			= 0;
+	m_usWidth		= 0;
+	m_usHeight		= 0;
+	m_iMin			= 0;
+	m_iMax			= 0;
+	m_usColumn		= 0;
+	m_usLastRow		= SPARKLINE_ROW_NONE;
+}
+
+
+//**************************************************************************
+//	Init
+//--------------------------------------------------------------------------
+//	The function binds the sparkline to the rectangle of usWidth columns
+//	starting at the pixel column usX and of usPages pages starting at
+//	usPage. The samples from iMin (bottom row) to iMax (top row) are
+//	shown. The display must already be initialized, the rectangle is
+//	cleared.
+//
+void SimpleOledSparkline::Init(	SimpleDisplayClass &clDisplay,
+								uint8_t usX, uint8_t usPage, uint8_t usWidth, uint8_t usPages,
+								int16_t iMin, int16_t iMax )
+{
+	m_pclDisplay	= &clDisplay;
+	m_usX			= usX;
+	m_usY			= usPage * PIXELS_PAGE_HEIGHT;
+	m_usWidth		= usWidth;
+	m_usHeight		= usPages * PIXELS_PAGE_HEIGHT;
+	m_iMin			= iMin;
+	m_iMax			= iMax;
+
+	Clear();
+}
+
+
+//**************************************************************************
+//	Clear
+//--------------------------------------------------------------------------
+//	The function clears the rectangle of the sparkline, the next sample
+//	goes to the first column.
+//
+void SimpleOledSparkline::Clear( void )
+{
+	m_usColumn	= 0;
+	m_usLastRow	= SPARKLINE_ROW_NONE;
+
+	if( NULL != m_pclDisplay )
+	{
+		m_pclDisplay->FillRect( m_usX, m_usY, m_usWidth, m_usHeight, false );
+	}
+}
+
+
+//**************************************************************************
+//	Add
+//--------------------------------------------------------------------------
+//	The function writes the sample into the next column of the sparkline.
+//	The column shows the line from the row of the previous sample to the
+//	row of this sample, the other rows of the column are cleared. After
+//	the last column the sparkline continues with the first column and
+//	overwrites the oldest samples.
+//
+void SimpleOledSparkline::Add( int16_t iSample )
+{
+	uint8_t	usRow;
+	uint8_t	usFirstRow;
+	uint8_t	usLastRow;
+
+	if( (NULL == m_pclDisplay) || (0 == m_usWidth) || (0 == m_usHeight) )
+	{
+		return;
+	}
+
+	usRow		= m_usY + m_usHeight - 1 - ScaleValue( iSample, m_iMin, m_iMax, m_usHeight - 1 );
+	usFirstRow	= usRow;
+	usLastRow	= usRow;
+
+	if( SPARKLINE_ROW_NONE != m_usLastRow )
+	{
+		if( m_usLastRow < usFirstRow )
+		{
+			usFirstRow = m_usLastRow;
+		}
+
+		if( m_usLastRow > usLastRow )
+		{
+			usLastRow = m_usLastRow;
+		}
+	}
+
+	m_pclDisplay->DrawColumn( m_usX + m_usColumn, m_usY, m_usHeight, usFirstRow, usLastRow );
+
+	m_usLastRow = usRow;
+
+	if( m_usWidth <= ++m_usColumn )
+	{
+		m_usColumn = 0;
+	}
+}
+
+
+////////////////////////////////////////////////////////////////////////////
+//
+//	CLASS: SimpleOledBarGraph
+//
+
+
+//**************************************************************************
+//	Constructor
+//--------------------------------------------------------------------------
+//
+SimpleOledBarGraph::SimpleOledBarGraph()
+{
+	m_pclDisplay	= NULL;
+	m_usX			= 0;
+	m_usY			= 0;
+	m_usWidth		= 0;
+	m_usHeight		= 0;
+	m_iMin			= 0;
+	m_iMax			= 0;
+	m_usLength		= 0;
+}
+
+
+//**************************************************************************
+//	Init
+//--------------------------------------------------------------------------
+//	The function binds the bar graph to the rectangle of usWidth columns
+//	starting at the pixel column usX and of usPages pages starting at
+//	usPage. The value iMin is an empty bar, iMax a full bar.
+//	The display must already be initialized, the rectangle is cleared.
+//
+void SimpleOledBarGraph::Init(	SimpleDisplayClass &clDisplay,
+								uint8_t usX, uint8_t usPage, uint8_t usWidth, uint8_t usPages,
+								int16_t iMin, int16_t iMax )
+{
+	m_pclDisplay	= &clDisplay;
+	m_usX			= usX;
+	m_usY			= usPage * PIXELS_PAGE_HEIGHT;
+	m_usWidth		= usWidth;
+	m_usHeight		= usPages * PIXELS_PAGE_HEIGHT;
+	m_iMin			= iMin;
+	m_iMax			= iMax;
+
+	Clear();
+}
+
+
+//**************************************************************************
+//	Clear
+//--------------------------------------------------------------------------
+//	The function clears the rectangle of the bar graph.
+//
+void SimpleOledBarGraph::Clear( void )
+{
+	m_usLength = 0;
+
+	if( NULL != m_pclDisplay )
+	{
+		m_pclDisplay->FillRect( m_usX, m_usY, m_usWidth, m_usHeight, false );
+	}
+}
+
+
+//**************************************************************************
+//	SetValue
+//--------------------------------------------------------------------------
+//	The function sets the length of the bar to the value. Only the
+//	columns between the old and the new end of the bar are transmitted.
+//
+void SimpleOledBarGraph::SetValue( int16_t iValue )
+{
+	uint8_t	usLength;
+
+	if( NULL == m_pclDisplay )
+	{
+		return;
+	}
+
+	usLength = ScaleValue( iValue, m_iMin, m_iMax, m_usWidth );
+
+	if( usLength > m_usLength )
+	{
+		m_pclDisplay->FillRect( m_usX + m_usLength, m_usY, usLength - m_usLength, m_usHeight, true );
+	}
+	else if( usLength < m_usLength )
+	{
+		m_pclDisplay->FillRect( m_usX + usLength, m_usY, m_usLength - usLength, m_usHeight, false );
+	}
+
+	m_usLength = usLength;
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		simple_oled_widgets.h
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Widgets for trend displays that are bound to a rectangle of pages of
+//#	a display:
+//#
+//#	SimpleOledSparkline:
+//#		every new sample writes one column of the rectangle, the columns
+//#		are used like a ring, so the graph is never shifted. A sample
+//#		costs one byte per page of the rectangle.
+//#
+//#	SimpleOledBarGraph:
+//#		a horizontal bar, a new value sets or clears only the columns
+//#		between the old and the new length of the bar.
+//#
+//#	The rectangle starts at a page (8 pixel rows), so all columns are
+//#	written with whole bytes, with and without framebuffer.
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+
+#include "simple_oled_config.h"
+#include "simple_oled_sh1106.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define SPARKLINE_ROW_NONE				0xFF
+
+
+//==========================================================================
+//
+//		C L A S S   D E F I N I T I O N S
+//
+//==========================================================================
+
+
+////////////////////////////////////////////////////////////////////////////
+//	CLASS: SimpleOledSparkline
+//
+class SimpleOledSparkline
+{
+	public:
+		SimpleOledSparkline();
+
+		void Init(	SimpleDisplayClass &clDisplay,
+					uint8_t usX, uint8_t usPage, uint8_t usWidth, uint8_t usPages,
+					int16_t iMin, int16_t iMax );
+		void Clear( void );
+		void Add( int16_t iSample );
+
+	private:
+		SimpleDisplayClass *	m_pclDisplay;
+		uint8_t					m_usX;
+		uint8_t					m_usY;
+		uint8_t					m_usWidth;
+		uint8_t					m_usHeight;
+		int16_t					m_iMin;
+		int16_t					m_iMax;
+		uint8_t					m_usColumn;
+		uint8_t					m_usLastRow;
+};
+
+
+////////////////////////////////////////////////////////////////////////////
+//	CLASS: SimpleOledBarGraph
+//
+class SimpleOledBarGraph
+{
+	public:
+		SimpleOledBarGraph();
+
+		void Init(	SimpleDisplayClass &clDisplay,
+					uint8_t usX, uint8_t usPage, uint8_t usWidth, uint8_t usPages,
+					int16_t iMin, int16_t iMax );
+		void Clear( void );
+		void SetValue( int16_t iValue );
+
+	private:
+		SimpleDisplayClass *	m_pclDisplay;
+		uint8_t					m_usX;
+		uint8_t					m_usY;
+		uint8_t					m_usWidth;
+		uint8_t					m_usHeight;
+		int16_t					m_iMin;
+		int16_t					m_iMax;
+		uint8_t					m_usLength;
+};